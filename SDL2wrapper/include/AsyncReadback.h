@@ -0,0 +1,130 @@
+#ifndef SDL2WRAPPER_ASYNCREADBACK_H_
+#define SDL2WRAPPER_ASYNCREADBACK_H_
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_mutex.h"
+#include "SDL2/include/SDL_pixels.h"
+
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Status.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+namespace detail
+{
+
+// Bounded single-producer single-consumer queue of ints.
+class IndexQueue
+{
+public:
+    explicit IndexQueue(int capacity);
+
+    // false when full
+    bool Push(int value) noexcept;
+    // false when empty
+    bool Pop(int& value) noexcept;
+
+private:
+    std::vector<int> slots_;
+    std::atomic<int> head_;
+    std::atomic<int> tail_;
+};
+
+} // detail
+
+struct ReadbackFrame
+{
+    // Capture() call this frame came from, counting from 0
+    Uint64 frame;
+    int w;
+    int h;
+    Uint32 format;
+    int pitch;
+    const void* pixels;
+};
+
+// Grabs frames without waiting for the GPU. Capture() copies a frame into
+// the next of depth staging targets and reads back the staging target it
+// filled depth captures ago, so the pixels arrive depth frames late. The
+// consumer runs on a worker thread and gets frames in order; the pixels
+// stay valid until it returns. Staging targets and pixel buffers are made
+// up front and recycled.
+//
+//     AsyncReadback grabs(renderer, 1280, 720, [](const ReadbackFrame& f) { ... });
+//     renderer.Target(scene);
+//     ...
+//     grabs.Capture(scene);
+//     renderer.Copy(scene);
+//     renderer.Present();
+//
+// Capture() leaves the default target bound. Frames are scaled to w x h.
+// When the consumer falls behind, frames are dropped rather than queued.
+class AsyncReadback
+{
+public:
+    using Consumer = std::function<void(const ReadbackFrame&)>;
+
+    AsyncReadback(Renderer& renderer, int w, int h, Consumer consumer,
+        int depth = 3, Uint32 format = SDL_PIXELFORMAT_ARGB8888);
+    // reads back nothing more, but delivers what was already read back
+    ~AsyncReadback();
+
+    AsyncReadback(const AsyncReadback& other) = delete;
+    AsyncReadback& operator=(const AsyncReadback& other) = delete;
+
+    AsyncReadback(AsyncReadback&& other) = delete;
+    AsyncReadback& operator=(AsyncReadback&& other) = delete;
+
+    AsyncReadback& Capture(Texture& frame);
+    // reads back every staged frame now, waiting for the GPU
+    AsyncReadback& Flush();
+
+    Status TryCapture(Texture& frame) noexcept;
+    Status TryFlush() noexcept;
+
+    int Depth() const;
+    Uint64 Captured() const;
+    // frames not delivered because every pixel buffer was in use
+    Uint64 Dropped() const;
+
+private:
+    Status ReadBack(Uint64 frame) noexcept;
+    Status StageCopy(Texture& frame, Texture& staging) noexcept;
+    void Work();
+
+    Renderer& renderer_;
+    int w_;
+    int h_;
+    Uint32 format_;
+    int pitch_;
+    Consumer consumer_;
+
+    std::vector<Texture> staging_;
+    // frames captured but not read back yet are [read_, captured_)
+    Uint64 captured_;
+    Uint64 read_;
+    Uint64 dropped_;
+    // buffer taken from free_ but not filled, -1 if none
+    int held_;
+
+    std::vector<std::vector<Uint8>> buffers_;
+    // frame held by each buffer, written before it is queued
+    std::vector<Uint64> buffer_frames_;
+    detail::IndexQueue free_;
+    detail::IndexQueue filled_;
+
+    // posted once per filled buffer and once more to stop the worker
+    SDL_sem* wake_;
+    std::thread worker_;
+};
+
+} // sdl2
+
+#endif
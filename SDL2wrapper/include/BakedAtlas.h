@@ -0,0 +1,130 @@
+#ifndef SDL2WRAPPER_BAKEDATLAS_H_
+#define SDL2WRAPPER_BAKEDATLAS_H_
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+
+#include "SDL2wrapper/include/MappedFile.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+#include "SDL2wrapper/include/TextureAtlas.h"
+
+namespace sdl2
+{
+
+namespace detail
+{
+
+// On-disk layout of a baked atlas, native byte order:
+//
+//     AtlasHeader
+//     AtlasPage[page_count]
+//     AtlasEntry[entry_count], sorted by name
+//     names, not terminated
+//     page pixels, each 16-byte aligned, rows pitch bytes apart
+struct AtlasHeader
+{
+    char magic[4];
+    Uint32 version;
+    Uint32 byte_order;
+    Uint32 format;
+    Uint32 page_count;
+    Uint32 entry_count;
+    Uint32 names_size;
+    Uint32 reserved;
+};
+
+struct AtlasPage
+{
+    Uint32 width;
+    Uint32 height;
+    Uint32 pitch;
+    Uint32 reserved;
+    Uint64 offset;
+};
+
+struct AtlasEntry
+{
+    Uint32 name_offset;
+    Uint32 name_size;
+    Uint32 page;
+    Sint32 x;
+    Sint32 y;
+    Sint32 w;
+    Sint32 h;
+    Uint32 reserved;
+};
+
+constexpr char kAtlasMagic[4] = {'S', 'D', 'L', 'A'};
+constexpr Uint32 kAtlasVersion = 1;
+constexpr Uint32 kAtlasByteOrder = 0x01020304;
+
+} // detail
+
+// Packs named surfaces offline and writes them as a baked atlas: raw page
+// pixels plus a sorted name index, so loading needs no image decoding.
+class AtlasBaker
+{
+public:
+    explicit AtlasBaker(int page_width = 2048, int page_height = 2048, int padding = 1);
+
+    AtlasBaker& Add(const std::string& name, Surface&& surface);
+    int Size() const;
+
+    // Pages are cropped to their used area. Throws on I/O errors and when a
+    // surface is larger than a page.
+    void Write(const std::string& path);
+
+private:
+    struct Sprite
+    {
+        std::string name;
+        Surface surface;
+    };
+
+    int page_width_;
+    int page_height_;
+    int padding_;
+    std::vector<Sprite> sprites_;
+};
+
+// Loads a baked atlas. The file is mapped and page pixels are uploaded
+// straight from the mapping; names are looked up in the mapped index.
+class BakedAtlas
+{
+public:
+    BakedAtlas(Renderer& renderer, const std::string& path);
+
+    BakedAtlas(BakedAtlas&& other) = default;
+    BakedAtlas& operator=(BakedAtlas&& other) = default;
+
+    BakedAtlas(const BakedAtlas& other) = delete;
+    BakedAtlas& operator=(const BakedAtlas& other) = delete;
+
+    std::optional<TextureAtlas::Region> Find(std::string_view name) const;
+
+    int Size() const;
+    std::string_view Name(int index) const;
+    TextureAtlas::Region Region(int index) const;
+
+    Texture& Page(int index);
+    Texture& Page(const TextureAtlas::Region& region);
+    int PageCount() const;
+
+private:
+    MappedFile file_;
+    const detail::AtlasEntry* entries_;
+    int entry_count_;
+    const char* names_;
+    std::vector<Texture> pages_;
+};
+
+} // sdl2
+
+#endif
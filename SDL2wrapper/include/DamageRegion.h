@@ -0,0 +1,40 @@
+#ifndef SDL2WRAPPER_DAMAGEREGION_H_
+#define SDL2WRAPPER_DAMAGEREGION_H_
+
+#include <vector>
+
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+// A small set of disjoint rectangles covering everything that changed in a
+// frame. Overlapping rectangles, and neighbours whose union wastes little
+// area, are merged as they are added; past max_rects the pair that grows
+// least is merged, so the set trades some overdraw for fewer rectangles.
+class DamageRegion
+{
+public:
+    explicit DamageRegion(int max_rects = 8);
+
+    DamageRegion& Add(const Rect& rect);
+    DamageRegion& Clear();
+
+    bool Empty() const;
+    bool Intersects(const Rect& rect) const;
+    const std::vector<Rect>& Rects() const;
+    // bounding box of every rectangle, empty when Empty()
+    Rect Bounds() const;
+    long long Area() const;
+    int MaxRects() const;
+
+private:
+    void Merge(Rect rect);
+
+    int max_rects_;
+    std::vector<Rect> rects_;
+};
+
+} // sdl2
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef SDL2WRAPPER_DRAWBUFFER_H_
+#define SDL2WRAPPER_DRAWBUFFER_H_
+
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_blendmode.h"
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RendererStats.h"
+#include "SDL2wrapper/include/Status.h"
+
+namespace sdl2
+{
+
+// Records textured and solid quads and submits them as few SDL_RenderGeometry
+// calls as possible. Quads are grouped by layer, then by (texture, blend mode);
+// a quad is only moved ahead of earlier quads it does not overlap, so the
+// visible result matches immediate drawing.
+//
+// Textures are referenced, not owned: they must stay alive and unchanged
+// until Flush().
+class DrawBuffer
+{
+public:
+    DrawBuffer();
+
+    DrawBuffer(DrawBuffer&& other) noexcept = default;
+    DrawBuffer& operator=(DrawBuffer&& other) noexcept = default;
+
+    DrawBuffer(const DrawBuffer& other) = delete;
+    DrawBuffer& operator=(const DrawBuffer& other) = delete;
+
+    // Empty quads are dropped; AddFill returns false for them.
+    Status AddCopy(SDL_Texture* texture,
+        const SDL_Rect* srcrect, const SDL_FRect& dstrect,
+        double angle, const SDL_FPoint* center, int flip, int layer
+    );
+    bool AddFill(const SDL_FRect& rect, const Color& color, SDL_BlendMode blend, int layer);
+
+    // On failure the remaining commands are dropped.
+    Status Flush(SDL_Renderer* renderer, detail::StatsCollector& stats);
+    void Clear();
+
+    bool Empty() const;
+    int Size() const;
+
+private:
+    struct Command
+    {
+        SDL_Texture* texture;
+        SDL_BlendMode blend;
+        int layer;
+        Rect bounds;
+        SDL_Vertex vertices[4];
+    };
+
+    struct Batch
+    {
+        SDL_Texture* texture;
+        SDL_BlendMode blend;
+        Rect bounds;
+    };
+
+    void BuildBatches();
+    Status Submit(SDL_Renderer* renderer, detail::StatsCollector& stats,
+        SDL_Texture* texture, SDL_BlendMode blend);
+
+    std::vector<Command> commands_;
+    std::vector<int> order_;
+    std::vector<int> batch_of_;
+    std::vector<int> batch_start_;
+    std::vector<Batch> batches_;
+    std::vector<int> sorted_;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+};
+
+} // sdl2
+
+#endif
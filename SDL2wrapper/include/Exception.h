@@ -1,9 +1,19 @@
 #ifndef SDL2WRAPPER_EXCEPTION_H_
 #define SDL2WRAPPER_EXCEPTION_H_
 
+#include <cstddef>
 #include <stdexcept>
 #include <string>
 
+// Without exceptions (-fno-exceptions or SDL2WRAPPER_NO_EXCEPTIONS) errors of
+// the throwing API are logged and abort(); use the Try* calls to handle them.
+#if defined(SDL2WRAPPER_NO_EXCEPTIONS) || \
+    !(defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND))
+    #define SDL2WRAPPER_EXCEPTIONS 0
+#else
+    #define SDL2WRAPPER_EXCEPTIONS 1
+#endif
+
 namespace sdl2
 {
 
@@ -12,6 +22,8 @@ class SDLException : public std::runtime_error
 private:
     static std::string make(const char* sdl_function, const char* sdl2_error);
 
+    SDLException(const char* function, const char* error);
+
 public:
     explicit SDLException(const char* function);
 
@@ -24,10 +36,12 @@ public:
     std::string SDLError() const;
 
 private:
-    std::string sdl_function_;
-    std::string sdl_error_;
+    // what() is "<function> failed: <error>"; the error starts here
+    std::size_t error_offset_;
 };
 
+[[noreturn]] void ThrowSDLException(const char* function);
+
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,94 @@
+#ifndef SDL2WRAPPER_FPOINT_H_
+#define SDL2WRAPPER_FPOINT_H_
+
+#include <iostream>
+#include <type_traits>
+
+#include "SDL2/include/SDL.h"
+#include "SDL2wrapper/include/Point.h"
+
+namespace sdl2
+{
+
+class FPoint : public SDL_FPoint
+{
+public:
+    constexpr FPoint() : SDL_FPoint{0.0f, 0.0f}
+    {}
+
+    constexpr FPoint(float x, float y) : SDL_FPoint{x, y}
+    {}
+
+    constexpr FPoint(const SDL_FPoint& point) : SDL_FPoint{point.x, point.y}
+    {}
+
+    constexpr explicit FPoint(const Point& point) :
+        SDL_FPoint{static_cast<float>(point.x), static_cast<float>(point.y)}
+    {}
+
+    FPoint(const FPoint&) noexcept = default;
+    FPoint(FPoint&&) noexcept = default;
+
+    FPoint& operator=(const FPoint&) noexcept = default;
+    FPoint& operator=(FPoint&&) noexcept = default;
+
+    constexpr FPoint operator-() const
+    {
+        return FPoint(-x, -y);
+    }
+
+    constexpr FPoint operator+(const FPoint& term) const
+    {
+        return FPoint(x + term.x, y + term.y);
+    }
+
+    constexpr FPoint operator-(const FPoint& term) const
+    {
+        return FPoint(x - term.x, y - term.y);
+    }
+
+    constexpr FPoint& operator+=(const FPoint& term)
+    {
+        x += term.x;
+        y += term.y;
+        return *this;
+    }
+
+    constexpr FPoint& operator-=(const FPoint& term)
+    {
+        x -= term.x;
+        y -= term.y;
+        return *this;
+    }
+
+    constexpr FPoint operator/(float value) const
+    {
+        return FPoint(x/value, y/value);
+    }
+
+    constexpr FPoint operator*(float value) const
+    {
+        return FPoint(x*value, y*value);
+    }
+};
+
+// arrays of FPoint are handed to SDL as arrays of SDL_FPoint without copying
+static_assert(sizeof(FPoint) == sizeof(SDL_FPoint), "FPoint must match SDL_FPoint layout");
+static_assert(std::is_standard_layout<FPoint>::value, "FPoint must match SDL_FPoint layout");
+
+} // sdl2
+
+constexpr bool operator==(const sdl2::FPoint& a, const sdl2::FPoint& b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+constexpr bool operator!=(const sdl2::FPoint& a, const sdl2::FPoint& b)
+{
+    return !(a == b);
+}
+
+std::ostream& operator<<(std::ostream& os, const sdl2::FPoint& point);
+
+
+#endif
@@ -0,0 +1,246 @@
+#ifndef SDL2WRAPPER_FRECT_H_
+#define SDL2WRAPPER_FRECT_H_
+
+#include <optional>
+#include <type_traits>
+
+#include "SDL2/include/SDL.h"
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+// Float counterpart of Rect. Unlike Rect, edges are not inclusive: X2() and
+// Y2() are x + w and y + h, and rectangles that only touch do not intersect,
+// matching SDL_HasIntersectionF.
+class FRect : public SDL_FRect
+{
+public:
+    constexpr FRect() : SDL_FRect{0.0f, 0.0f, 0.0f, 0.0f}
+    {}
+    constexpr FRect(float x, float y, float w, float h) : SDL_FRect{x, y, w, h}
+    {}
+    constexpr FRect(const SDL_FRect& rect) : SDL_FRect{rect.x, rect.y, rect.w, rect.h}
+    {}
+    constexpr FRect(const FPoint& start, const FPoint& size) :
+        SDL_FRect{start.x, start.y, size.x, size.y}
+    {}
+    constexpr FRect(const FPoint& start, float w, float h) :
+        SDL_FRect{start.x, start.y, w, h}
+    {}
+    constexpr explicit FRect(const Rect& rect) :
+        SDL_FRect{
+            static_cast<float>(rect.x), static_cast<float>(rect.y),
+            static_cast<float>(rect.w), static_cast<float>(rect.h)
+        }
+    {}
+    FRect(const FRect&) noexcept = default;
+    FRect(FRect&&) noexcept = default;
+
+    static constexpr FRect FromCenter(const FPoint& center, float w, float h)
+    {
+        return FromCenter(center.x, center.y, w, h);
+    }
+
+    static constexpr FRect FromCenter(float cx, float cy, float w, float h)
+    {
+        return FRect(cx - w/2, cy - h/2, w, h);
+    }
+
+    static constexpr FRect FromCenter(const FPoint& center, const FPoint& size)
+    {
+        return FRect(center - size / 2, size);
+    }
+
+    static constexpr FRect FromCorners(const FPoint& tl, const FPoint& br)
+    {
+        return FRect(tl, br - tl);
+    }
+
+    static constexpr FRect FromCorners(float x1, float y1, float x2, float y2)
+    {
+        return FRect(x1, y1, x2-x1, y2-y1);
+    }
+
+    FRect& operator=(const FRect&) noexcept = default;
+    FRect& operator=(FRect&&) noexcept = default;
+
+    constexpr float X() const
+    {
+        return x;
+    }
+
+    FRect& X(float nx)
+    {
+        x = nx;
+        return *this;
+    }
+
+    constexpr float Y() const
+    {
+        return y;
+    }
+
+    FRect& Y(float ny)
+    {
+        y = ny;
+        return *this;
+    }
+
+    constexpr float W() const
+    {
+        return w;
+    }
+
+    FRect& W(float nw)
+    {
+        w = nw;
+        return *this;
+    }
+
+    constexpr float H() const
+    {
+        return h;
+    }
+
+    FRect& H(float nh)
+    {
+        h = nh;
+        return *this;
+    }
+
+    constexpr float X2() const
+    {
+        return x + w;
+    }
+
+    FRect& X2(float nx2)
+    {
+        w = nx2 - x;
+        return *this;
+    }
+
+    constexpr float Y2() const
+    {
+        return y + h;
+    }
+
+    FRect& Y2(float ny2)
+    {
+        h = ny2 - y;
+        return *this;
+    }
+
+    constexpr FPoint TopLeft() const
+    {
+        return FPoint(x, y);
+    }
+
+    constexpr FPoint TopRight() const
+    {
+        return FPoint(X2(), y);
+    }
+
+    constexpr FPoint BottomLeft() const
+    {
+        return FPoint(x, Y2());
+    }
+
+    constexpr FPoint BottomRight() const
+    {
+        return FPoint(X2(), Y2());
+    }
+
+    constexpr FPoint Center() const
+    {
+        return FPoint(x + w/2, y + h/2);
+    }
+
+    constexpr bool Contains(float px, float py) const
+    {
+        return px >= x && py >= y && px < X2() && py < Y2();
+    }
+
+    constexpr bool Contains(const FPoint& point) const
+    {
+        return Contains(point.x, point.y);
+    }
+
+    constexpr bool Contains(const FRect& rect) const
+    {
+        return rect.x >= x && rect.y >= y && rect.X2() <= X2() && rect.Y2() <= Y2();
+    }
+
+    constexpr bool Intersects(const FRect& rect) const
+    {
+        return !(rect.X2() <= x || rect.Y2() <= y || rect.x >= X2() || rect.y >= Y2());
+    }
+
+    FRect Union(const FRect& rect) const;
+
+    FRect& MakeUnionWith(const FRect& rect);
+
+    FRect Extension(float amount) const;
+
+    FRect Extension(float hamount, float vamount) const;
+
+    FRect& Extend(float amount);
+
+    FRect& Extend(float hamount, float vamount);
+
+    std::optional<FRect> GetIntersection(const FRect& rect) const;
+
+    // smallest integer Rect covering this one
+    Rect Enclosing() const;
+
+#if SDL_VERSION_ATLEAST(2, 0, 22)
+    bool IntersectsLine(float& x1, float& y1, float& x2, float& y2) const;
+
+    bool IntersectsLine(FPoint& p1, FPoint& p2) const;
+#endif
+
+    constexpr FRect operator+(const FPoint& offset) const
+    {
+        return FRect(x + offset.x, y + offset.y, w, h);
+    }
+
+    constexpr FRect operator-(const FPoint& offset) const
+    {
+        return FRect(x - offset.x, y - offset.y, w, h);
+    }
+
+    FRect& operator+=(const FPoint& offset)
+    {
+        x += offset.x;
+        y += offset.y;
+        return *this;
+    }
+
+    FRect& operator-=(const FPoint& offset)
+    {
+        x -= offset.x;
+        y -= offset.y;
+        return *this;
+    }
+};
+
+// arrays of FRect are handed to SDL as arrays of SDL_FRect without copying
+static_assert(sizeof(FRect) == sizeof(SDL_FRect), "FRect must match SDL_FRect layout");
+static_assert(std::is_standard_layout<FRect>::value, "FRect must match SDL_FRect layout");
+
+} // sdl2
+
+constexpr bool operator==(const sdl2::FRect& a, const sdl2::FRect& b)
+{
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+constexpr bool operator!=(const sdl2::FRect& a, const sdl2::FRect& b)
+{
+    return !(a == b);
+}
+
+std::ostream &operator<<(std::ostream& stream, const sdl2::FRect& rect);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef SDL2WRAPPER_LINECLIP_H_
+#define SDL2WRAPPER_LINECLIP_H_
+
+#include <vector>
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+// Batch versions of Rect::IntersectsLine for clipping many lines against
+// one rect. Every segment is clipped exactly as SDL_IntersectRectAndLine
+// clips it; segments it rejects are dropped from the output.
+
+// Segments are the pairs (points[2i], points[2i + 1]) and count is the
+// number of points. Surviving segments are written to out as pairs; out
+// needs room for count points. Returns the number of points written.
+int ClipSegments(const Rect& rect, const Point* points, int count, Point* out);
+void ClipSegments(const Rect& rect, const std::vector<Point>& points, std::vector<Point>& out);
+
+// Clips the polyline through count points. Visible pieces are written to
+// out back to back, each a polyline for Renderer::DrawLines, and runs gets
+// the number of points in each piece. out needs room for 2 * (count - 1)
+// points and runs for count - 1 entries. Returns the number of pieces.
+int ClipPolyline(const Rect& rect, const Point* points, int count, Point* out, int* runs);
+void ClipPolyline(const Rect& rect, const std::vector<Point>& points,
+    std::vector<Point>& out, std::vector<int>& runs);
+
+} // sdl2
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef SDL2WRAPPER_MAPPEDFILE_H_
+#define SDL2WRAPPER_MAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+
+namespace sdl2
+{
+
+// Read-only view of a whole file: mmap where POSIX is available, otherwise
+// the file is read into memory with SDL_RWops.
+class MappedFile
+{
+public:
+    MappedFile();
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+    const Uint8* Data() const;
+    std::size_t Size() const;
+    bool Mapped() const;
+
+private:
+    void Release();
+
+    const Uint8* data_;
+    std::size_t size_;
+    bool mapped_;
+    std::vector<Uint8> buffer_;
+};
+
+} // sdl2
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef SDL2WRAPPER_MESH_H_
+#define SDL2WRAPPER_MESH_H_
+
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+// Retained vertex/index data drawn with a single SDL_RenderGeometry call by
+// Renderer::Draw. Build it once and patch sub-ranges in place instead of
+// rebuilding it every frame. The texture is referenced, not owned, and may be
+// null for untextured geometry; its color and alpha modulation is not applied.
+// Without indices the vertices are drawn as a triangle list.
+class Mesh
+{
+public:
+    Mesh();
+    explicit Mesh(Texture* texture);
+
+    Mesh(Mesh&& other) noexcept = default;
+    Mesh& operator=(Mesh&& other) noexcept = default;
+
+    Mesh(const Mesh& other) = delete;
+    Mesh& operator=(const Mesh& other) = delete;
+
+    Mesh& SetTexture(Texture* texture);
+    Mesh& Clear();
+    Mesh& Reserve(int vertices, int indices);
+
+    // return the index of the first added vertex
+    int AddVertices(const SDL_Vertex* vertices, int count);
+    int AddVertices(const std::vector<SDL_Vertex>& vertices);
+    // textured quad as 4 vertices and 6 indices; srcrect is in texels. The
+    // first quad added to a mesh without indices indexes the vertices before
+    // it as a triangle list, so they keep drawing.
+    int AddQuad(const Rect& srcrect, const FRect& dstrect, const Color& color = Color(255, 255, 255));
+    // untextured quad
+    int AddQuad(const FRect& dstrect, const Color& color);
+    Mesh& AddIndices(const int* indices, int count);
+    Mesh& AddIndices(const std::vector<int>& indices);
+
+    // in-place updates of existing ranges
+    Mesh& UpdateVertices(int first, const SDL_Vertex* vertices, int count);
+    Mesh& UpdateIndices(int first, const int* indices, int count);
+    Mesh& UpdateQuad(int first, const Rect& srcrect, const FRect& dstrect, const Color& color = Color(255, 255, 255));
+    Mesh& SetColor(int first, int count, const Color& color);
+    Mesh& Translate(int first, int count, const FPoint& offset);
+
+    SDL_Texture* GetTexture() const;
+    bool Empty() const;
+
+    SDL_Vertex* Vertices();
+    const SDL_Vertex* Vertices() const;
+    int VertexCount() const;
+    const int* Indices() const;
+    int IndexCount() const;
+
+private:
+    void QuadVertices(SDL_Vertex* quad, const Rect& srcrect, const FRect& dstrect, const Color& color) const;
+
+    SDL_Texture* texture_;
+    float inv_width_;
+    float inv_height_;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+};
+
+} // sdl2
+
+#endif
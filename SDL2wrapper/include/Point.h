@@ -2,6 +2,7 @@
 #define SDL2WRAPPER_POINT_H_
 
 #include <iostream>
+#include <type_traits>
 
 #include "SDL2/include/SDL.h"
 
@@ -66,6 +67,10 @@ public:
     }
 };
 
+// arrays of Point are handed to SDL as arrays of SDL_Point without copying
+static_assert(sizeof(Point) == sizeof(SDL_Point), "Point must match SDL_Point layout");
+static_assert(std::is_standard_layout<Point>::value, "Point must match SDL_Point layout");
+
 } // sdl2
 
 constexpr bool operator==(const sdl2::Point& a, const sdl2::Point& b)
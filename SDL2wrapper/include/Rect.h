@@ -2,6 +2,7 @@
 #define SDL2WRAPPER_RECT_H_
 
 #include <optional>
+#include <type_traits>
 
 #include "SDL2/include/SDL.h"
 #include "SDL2wrapper/include/Point.h"
@@ -209,6 +210,10 @@ public:
     }
 };
 
+// arrays of Rect are handed to SDL as arrays of SDL_Rect without copying
+static_assert(sizeof(Rect) == sizeof(SDL_Rect), "Rect must match SDL_Rect layout");
+static_assert(std::is_standard_layout<Rect>::value, "Rect must match SDL_Rect layout");
+
 } // sdl2
 
 constexpr bool operator==(const sdl2::Rect& a, const sdl2::Rect& b)
@@ -0,0 +1,94 @@
+#ifndef SDL2WRAPPER_RECTARRAY_H_
+#define SDL2WRAPPER_RECTARRAY_H_
+
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+namespace detail
+{
+
+// what a kernel reads; padded is a whole number of blocks
+struct RectLanes
+{
+    const int* x1;
+    const int* y1;
+    const int* x2;
+    const int* y2;
+    int padded;
+};
+
+// RectArray picks the best kernel the CPU supports. Tests and benchmarks
+// switch between them; not thread-safe against running queries.
+enum class RectKernel
+{
+    kScalar,
+    kSse41,
+    kAvx2,
+};
+
+bool RectKernelSupported(RectKernel kernel);
+// false, leaving the kernel as it was, when the CPU lacks it
+bool UseRectKernel(RectKernel kernel);
+RectKernel ActiveRectKernel();
+
+} // detail
+
+// Rects stored as separate x1, y1, x2, y2 lanes (x2 and y2 exclusive) so one
+// rect can be tested against many at once. The tests give the same answers
+// as the Rect member functions of the same name.
+//
+// Kernels use AVX2 or SSE4.1 when the CPU has them and a scalar loop
+// otherwise, chosen at run time whatever the build flags.
+//
+// Mask outputs need MaskWords() words; bit i of the mask is rect i.
+// Index outputs need room for Size() indices and return the match count.
+class RectArray
+{
+public:
+    RectArray();
+    explicit RectArray(const std::vector<Rect>& rects);
+
+    RectArray& Add(const Rect& rect);
+    RectArray& Set(int index, const Rect& rect);
+    RectArray& Reserve(int count);
+    RectArray& Clear();
+
+    Rect Get(int index) const;
+    int Size() const;
+    int MaskWords() const;
+
+    // rects[i].Intersects(rect)
+    void Intersects(const Rect& rect, Uint64* mask) const;
+    int Intersects(const Rect& rect, int* indices) const;
+    // rects[i].Contains(point)
+    void Contains(const Point& point, Uint64* mask) const;
+    int Contains(const Point& point, int* indices) const;
+    // rects[i].Contains(rect)
+    void Contains(const Rect& rect, Uint64* mask) const;
+    int Contains(const Rect& rect, int* indices) const;
+
+    // union of every rect, empty when there are none
+    Rect Bounds() const;
+
+private:
+    detail::RectLanes Lanes() const;
+    void Pad();
+
+    int size_;
+    // padded to whole blocks with rects that never match
+    std::vector<int> x1_;
+    std::vector<int> y1_;
+    std::vector<int> x2_;
+    std::vector<int> y2_;
+};
+
+} // sdl2
+
+#endif
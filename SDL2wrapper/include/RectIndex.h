@@ -0,0 +1,124 @@
+#ifndef SDL2WRAPPER_RECTINDEX_H_
+#define SDL2WRAPPER_RECTINDEX_H_
+
+#include <vector>
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+// Spatial indexes over Rects for culling and picking. Rects are added with
+// Insert, which returns a handle for Update and Remove; handles of removed
+// rects are reused. Queries write the handles of every rect that intersects
+// the area (or contains the point) into a caller buffer without allocating,
+// and return the number of matches, which may exceed the buffer capacity.
+// Rects may lie partly or wholly outside the bounds given at construction,
+// at some cost in query time.
+
+// Uniform grid, best for many similarly sized rects. A rect is listed in
+// every cell it overlaps.
+class GridIndex
+{
+public:
+    GridIndex(const Rect& bounds, int cell_size);
+
+    int Insert(const Rect& rect);
+    void Update(int handle, const Rect& rect);
+    void Remove(int handle);
+    void Clear();
+
+    const Rect& Get(int handle) const;
+    int Size() const;
+
+    int Query(const Rect& area, int* handles, int capacity) const;
+    int Query(const Point& point, int* handles, int capacity) const;
+    // clears handles first; allocates only when it must grow
+    int Query(const Rect& area, std::vector<int>& handles) const;
+
+private:
+    struct Entry
+    {
+        Rect rect;
+        bool alive;
+    };
+
+    struct CellRange
+    {
+        int x1, y1, x2, y2;
+    };
+
+    int CellX(int x) const;
+    int CellY(int y) const;
+    CellRange Cells(const Rect& rect) const;
+    void Link(int handle);
+    void Unlink(int handle);
+    template <typename Output>
+    int Collect(const Rect& area, Output output) const;
+
+    Rect bounds_;
+    int cell_size_;
+    int columns_;
+    int rows_;
+    std::vector<std::vector<int>> cells_;
+    std::vector<Entry> entries_;
+    std::vector<int> free_;
+    int size_;
+};
+
+// Loose quadtree, for rects of mixed sizes. Each rect is stored once, in
+// the level whose cells are at least as large as the rect, in the cell
+// holding its center; cells are searched as if twice their size. Levels
+// are flat grids, so no tree is walked.
+class QuadtreeIndex
+{
+public:
+    explicit QuadtreeIndex(const Rect& bounds, int max_depth = 6);
+
+    int Insert(const Rect& rect);
+    void Update(int handle, const Rect& rect);
+    void Remove(int handle);
+    void Clear();
+
+    const Rect& Get(int handle) const;
+    int Size() const;
+    int Depth() const;
+
+    int Query(const Rect& area, int* handles, int capacity) const;
+    int Query(const Point& point, int* handles, int capacity) const;
+    int Query(const Rect& area, std::vector<int>& handles) const;
+
+private:
+    struct Entry
+    {
+        Rect rect;
+        int level;
+        int cell;
+        // position in the cell's list, -1 when free
+        int slot;
+    };
+
+    struct Level
+    {
+        int cell_w;
+        int cell_h;
+        int columns;
+        std::vector<std::vector<int>> cells;
+    };
+
+    void Place(int handle);
+    void Unplace(int handle);
+    template <typename Output>
+    int Collect(const Rect& area, Output output) const;
+
+    Rect bounds_;
+    std::vector<Level> levels_;
+    std::vector<Entry> entries_;
+    std::vector<int> free_;
+    int size_;
+};
+
+} // sdl2
+
+#endif
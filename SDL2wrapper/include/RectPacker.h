@@ -0,0 +1,43 @@
+#ifndef SDL2WRAPPER_RECTPACKER_H_
+#define SDL2WRAPPER_RECTPACKER_H_
+
+#include <optional>
+#include <vector>
+
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+// MaxRects bin packer with best-short-side-fit placement. Rectangles are
+// placed one at a time and never moved, so late insertions do not disturb
+// earlier ones.
+class RectPacker
+{
+public:
+    RectPacker(int width, int height);
+
+    // nullopt when there is no free area large enough
+    std::optional<Rect> Insert(int w, int h);
+    void Clear();
+
+    int Width() const;
+    int Height() const;
+    // used area / total area
+    double Occupancy() const;
+    const std::vector<Rect>& FreeRects() const;
+
+private:
+    bool SplitFreeRect(const Rect& free, const Rect& used);
+    void PruneFreeRects();
+
+    int width_;
+    int height_;
+    long long used_area_;
+    std::vector<Rect> free_;
+    std::vector<Rect> split_;
+};
+
+} // sdl2
+
+#endif
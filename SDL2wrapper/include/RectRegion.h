@@ -0,0 +1,74 @@
+#ifndef SDL2WRAPPER_RECTREGION_H_
+#define SDL2WRAPPER_RECTREGION_H_
+
+#include <vector>
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+// An arbitrary set of pixels stored as non-overlapping rects in y-x banded
+// order, as in X11 and pixman regions: rects are sorted by y then x, rects
+// in a band share y and h, neighbours within a band never touch and
+// vertically adjacent bands with identical spans are merged. Every
+// operation keeps that form, so two regions that cover the same pixels
+// compare equal.
+class RectRegion
+{
+public:
+    using const_iterator = std::vector<Rect>::const_iterator;
+
+    RectRegion();
+    explicit RectRegion(const Rect& rect);
+    // union of rects, O(n log n)
+    RectRegion(const Rect* rects, int count);
+    explicit RectRegion(const std::vector<Rect>& rects);
+
+    RectRegion Union(const RectRegion& region) const;
+    RectRegion Intersection(const RectRegion& region) const;
+    RectRegion Difference(const RectRegion& region) const;
+
+    RectRegion& MakeUnionWith(const RectRegion& region);
+    RectRegion& Intersect(const RectRegion& region);
+    RectRegion& Subtract(const RectRegion& region);
+    RectRegion& Translate(const Point& offset);
+    RectRegion& Clear();
+
+    bool Empty() const;
+    bool Contains(const Point& point) const;
+    bool Contains(const Rect& rect) const;
+    bool Intersects(const Rect& rect) const;
+
+    // bounding box, empty when Empty()
+    Rect Bounds() const;
+    long long Area() const;
+    int Size() const;
+    const std::vector<Rect>& Rects() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    bool operator==(const RectRegion& region) const;
+    bool operator!=(const RectRegion& region) const;
+
+private:
+    enum class Op
+    {
+        Union,
+        Intersection,
+        Difference
+    };
+
+    static RectRegion Combine(const RectRegion& a, const RectRegion& b, Op op);
+    static RectRegion UnionOf(const Rect* rects, int count);
+    // first rect of the band that contains or follows y
+    const_iterator FindBand(int y) const;
+
+    std::vector<Rect> rects_;
+    Rect bounds_;
+};
+
+} // sdl2
+
+#endif
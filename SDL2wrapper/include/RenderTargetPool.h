@@ -0,0 +1,114 @@
+#ifndef SDL2WRAPPER_RENDERTARGETPOOL_H_
+#define SDL2WRAPPER_RENDERTARGETPOOL_H_
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_pixels.h"
+
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+// Reuses SDL_TEXTUREACCESS_TARGET textures across frames instead of
+// creating and destroying them for every pass. Targets are leased by size
+// and format and go back to the pool when the lease ends; targets left idle
+// for more than max_idle_frames calls to EndFrame are destroyed.
+//
+//     RenderTargetPool::Lease blur = pool.Acquire(w, h);
+//     renderer.Target(*blur);
+//     ...
+//     pool.EndFrame();
+//
+// A reused target keeps whatever was last drawn to it. The pool must
+// outlive its leases.
+class RenderTargetPool
+{
+    struct Entry
+    {
+        Texture texture;
+        bool leased;
+        Uint64 last_used;
+    };
+
+public:
+    class Lease
+    {
+        friend class RenderTargetPool;
+
+        explicit Lease(Entry* entry);
+    public:
+        Lease();
+        ~Lease();
+
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+
+        Lease(const Lease& other) = delete;
+        Lease& operator=(const Lease& other) = delete;
+
+        Texture& Get() const;
+        Texture& operator*() const;
+        Texture* operator->() const;
+        explicit operator bool() const;
+
+        // returns the target to the pool early
+        void Release();
+    private:
+        Entry* entry_;
+    };
+
+    explicit RenderTargetPool(Renderer& renderer, int max_idle_frames = 2);
+    ~RenderTargetPool();
+
+    RenderTargetPool(const RenderTargetPool& other) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool& other) = delete;
+
+    RenderTargetPool(RenderTargetPool&& other) = delete;
+    RenderTargetPool& operator=(RenderTargetPool&& other) = delete;
+
+    Lease Acquire(int w, int h, Uint32 format = SDL_PIXELFORMAT_ARGB8888);
+
+    // Advances the frame counter and destroys targets that have been idle
+    // for more than max_idle_frames frames.
+    RenderTargetPool& EndFrame();
+    // destroys every idle target
+    RenderTargetPool& Trim();
+
+    int Size() const;
+    int Leased() const;
+    int MaxIdleFrames() const;
+    RenderTargetPool& MaxIdleFrames(int frames);
+
+    // Acquire calls served from the pool and calls that created a target
+    Uint64 Hits() const;
+    Uint64 Misses() const;
+    // targets destroyed by EndFrame and Trim
+    Uint64 Evictions() const;
+    RenderTargetPool& ResetCounters();
+
+private:
+    using Key = std::tuple<int, int, Uint32>;
+    // unique_ptr keeps entries in place while leases point at them
+    using Bucket = std::vector<std::unique_ptr<Entry>>;
+
+    // all drops every idle target regardless of age
+    void Evict(bool all);
+
+    Renderer* renderer_;
+    int max_idle_frames_;
+    Uint64 frame_;
+    Uint64 hits_;
+    Uint64 misses_;
+    Uint64 evictions_;
+    std::map<Key, Bucket> buckets_;
+};
+
+} // sdl2
+
+#endif
@@ -2,14 +2,23 @@
 #define SDL2WRAPPER_RENDERER_H_
 
 #include <optional>
+#include <vector>
 
 #include "SDL2/include/SDL_stdinc.h"
 #include "SDL2/include/SDL_blendmode.h"
 
 #include "SDL2wrapper/include/Pointers.h"
+#include "SDL2wrapper/include/DrawBuffer.h"
 #include "SDL2wrapper/include/Point.h"
 #include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/DamageRegion.h"
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Mesh.h"
 #include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RendererStats.h"
+#include "SDL2wrapper/include/SpriteBatch.h"
+#include "SDL2wrapper/include/Status.h"
 #include "SDL2wrapper/include/Window.h"
 #include "SDL2wrapper/include/Texture.h"
 
@@ -35,8 +44,48 @@ public:
 
     Renderer& Clear();
 
+    // Render state is mirrored on the CPU: setters that change nothing are
+    // dropped and getters do not query SDL. Clear(), Flush(), Present() and
+    // Target() re-read the viewport when the output has been resized or the
+    // target texture destroyed. Call Resync() after changing the state
+    // through Get().
+    Renderer& Resync();
+
+    // Stats() is the frame in progress, FrameStats() the last presented one.
+    const RendererStats& Stats() const;
+    const RendererStats& FrameStats() const;
+
     void GetInfo(SDL_RendererInfo& info);
 
+    // In deferred mode Copy and FillRect are recorded and submitted as
+    // batched geometry on Flush() or Present(); any other drawing or state
+    // change flushes first. Textures must outlive the flush.
+    Renderer& Deferred(bool enabled);
+    bool Deferred() const;
+    Renderer& Layer(int layer);
+    int Layer() const;
+    Renderer& Flush();
+
+    // With culling on, Copy, DrawRect(s) and FillRect(s) calls whose
+    // destination misses Viewport() and ClipRect() are dropped before they
+    // reach SDL or the deferred buffer. Rotated copies are tested by their
+    // rotated bounds and arrays by the bounds of the whole array.
+    Renderer& Cull(bool enabled);
+    bool Cull() const;
+
+    // Dirty-rectangle mode, for renderers whose output keeps its contents
+    // between frames such as the software renderer. Drawing to the default
+    // target is clipped to the damaged region and calls that miss it are
+    // skipped, so a frame redrawn in full only costs what changed. Damage is
+    // in drawing coordinates; Clear() fills just the damaged area. For a
+    // software renderer on a window, Present() updates only the damaged
+    // window rects. Enabling the mode, Resync() and view changes damage
+    // the whole viewport; Present() clears the damage.
+    Renderer& DirtyRects(bool enabled);
+    bool DirtyRects() const;
+    Renderer& Invalidate(const std::optional<Rect>& rect = std::nullopt);
+    const DamageRegion& Damage() const;
+
     Renderer& Copy(Texture& texture, 
         const std::optional<Rect>& srcrect = std::nullopt, 
         const std::optional<Rect>& dstrect = std::nullopt
@@ -59,6 +108,34 @@ public:
         const std::optional<Point>& center = std::nullopt,
         int flip = 0
     );
+    Renderer& Copy(Texture& texture,
+        const std::optional<Rect>& srcrect,
+        const FRect& dstrect
+    );
+    Renderer& Copy(Texture& texture,
+        const std::optional<Rect>& srcrect,
+        const FPoint& dstpoint
+    );
+    Renderer& Copy(Texture& texture,
+        const std::optional<Rect>& srcrect,
+        const FRect& dstrect,
+        double angle,
+        const std::optional<FPoint>& center = std::nullopt,
+        int flip = 0
+    );
+    Renderer& CopyBatch(Texture& texture, const CopyCommand* commands, int count);
+    Renderer& Draw(const SpriteBatch& batch);
+    Renderer& Draw(const Mesh& mesh);
+    // SDL_RenderGeometry: texture may be null, indices are optional and the
+    // texture color and alpha modulation is not applied
+    Renderer& Geometry(Texture* texture,
+        const SDL_Vertex* vertices, int num_vertices,
+        const int* indices = nullptr, int num_indices = 0
+    );
+    Renderer& Geometry(Texture* texture,
+        const std::vector<SDL_Vertex>& vertices,
+        const std::vector<int>& indices = std::vector<int>()
+    );
     Renderer& FillCopy(Texture& texture,
         const std::optional<Rect>& srcrect = std::nullopt,
         const std::optional<Rect>& dstrect = std::nullopt,
@@ -77,20 +154,36 @@ public:
     Renderer& DrawPoint(int x, int y);
     Renderer& DrawPoint(const Point& p);
     Renderer& DrawPoints(const Point* points, int count);
+    Renderer& DrawPoints(const std::vector<Point>& points);
+    Renderer& DrawPoint(const FPoint& p);
+    Renderer& DrawPoints(const FPoint* points, int count);
+    Renderer& DrawPoints(const std::vector<FPoint>& points);
 
     Renderer& DrawLine(int x1, int y1, int x2, int y2);
     Renderer& DrawLine(const Point& start, const Point& end);
     Renderer& DrawLines(const Point* points, int count);
+    Renderer& DrawLines(const std::vector<Point>& points);
+    Renderer& DrawLine(const FPoint& start, const FPoint& end);
+    Renderer& DrawLines(const FPoint* points, int count);
+    Renderer& DrawLines(const std::vector<FPoint>& points);
 
     Renderer& DrawRect(int x1, int y1, int x2, int y2);
     Renderer& DrawRect(const Point& top_left, const Point& bottom_right);
     Renderer& DrawRect(const Rect& rect);
     Renderer& DrawRects(const Rect* rects, int count);
+    Renderer& DrawRects(const std::vector<Rect>& rects);
+    Renderer& DrawRect(const FRect& rect);
+    Renderer& DrawRects(const FRect* rects, int count);
+    Renderer& DrawRects(const std::vector<FRect>& rects);
 
     Renderer& FillRect(int x1, int y1, int x2, int y2);
     Renderer& FillRect(const Point& top_left, const Point& bottom_right);
     Renderer& FillRect(const Rect& rect);
     Renderer& FillRects(const Rect* rects, int count);
+    Renderer& FillRects(const std::vector<Rect>& rects);
+    Renderer& FillRect(const FRect& rect);
+    Renderer& FillRects(const FRect* rects, int count);
+    Renderer& FillRects(const std::vector<FRect>& rects);
 
     void ReadPixels(const std::optional<Rect>& rect, Uint32 format, void* pixels, int pitch);
 
@@ -115,8 +208,90 @@ public:
     Point OutputSize() const;
     int OutputWidth() const;
     int OutputHeight() const;
+
+    // Non-throwing variants of the drawing calls above, for hot loops and
+    // builds without exceptions. The throwing calls are built on these.
+    Status TryFlush() noexcept;
+    Status TryClear() noexcept;
+    Status TryCopy(Texture& texture, const SDL_Rect* srcrect, const SDL_Rect* dstrect) noexcept;
+    Status TryCopy(Texture& texture, const SDL_Rect* srcrect, const SDL_Rect* dstrect,
+        double angle, const SDL_Point* center, int flip) noexcept;
+    Status TryCopy(Texture& texture, const SDL_Rect* srcrect, const FRect& dstrect) noexcept;
+    Status TryCopy(Texture& texture, const SDL_Rect* srcrect, const FRect& dstrect,
+        double angle, const SDL_FPoint* center, int flip) noexcept;
+    Status TryDraw(const SpriteBatch& batch) noexcept;
+    Status TryDraw(const Mesh& mesh) noexcept;
+    Status TryGeometry(Texture* texture,
+        const SDL_Vertex* vertices, int num_vertices,
+        const int* indices, int num_indices) noexcept;
+    Status TrySetDrawColor(const Color& color) noexcept;
+    Status TryDrawBlendMode(SDL_BlendMode blend) noexcept;
+    Status TryTarget(Texture* texture) noexcept;
+    Status TryDrawPoint(int x, int y) noexcept;
+    Status TryDrawPoints(const Point* points, int count) noexcept;
+    Status TryDrawLine(int x1, int y1, int x2, int y2) noexcept;
+    Status TryDrawLines(const Point* points, int count) noexcept;
+    Status TryDrawRect(const Rect& rect) noexcept;
+    Status TryDrawRects(const Rect* rects, int count) noexcept;
+    Status TryFillRect(const Rect& rect) noexcept;
+    Status TryFillRects(const Rect* rects, int count) noexcept;
+    Status TryDrawPoint(const FPoint& p) noexcept;
+    Status TryDrawPoints(const FPoint* points, int count) noexcept;
+    Status TryDrawLine(const FPoint& start, const FPoint& end) noexcept;
+    Status TryDrawLines(const FPoint* points, int count) noexcept;
+    Status TryDrawRect(const FRect& rect) noexcept;
+    Status TryDrawRects(const FRect* rects, int count) noexcept;
+    Status TryFillRect(const FRect& rect) noexcept;
+    Status TryFillRects(const FRect* rects, int count) noexcept;
+    Status TryReadPixels(const SDL_Rect* rect, Uint32 format, void* pixels, int pitch) noexcept;
 private:
+    struct State
+    {
+        Color draw_color;
+        SDL_BlendMode draw_blend = SDL_BLENDMODE_NONE;
+        SDL_Texture* target = nullptr;
+        std::optional<Rect> clip_rect;
+        Rect viewport;
+        float scale_x = 1.0f;
+        float scale_y = 1.0f;
+        Point logical_size;
+        // a change means SDL has reset the viewport
+        Point output_size;
+    };
+
+    Status FlushDeferred() noexcept;
+    bool CullActive() const;
+    bool Culled(const Rect& bounds) noexcept;
+    bool DamageActive() const;
+    template <typename DrawCall>
+    Status DrawDamaged(const Rect& bounds, DrawCall draw) noexcept;
+    Status ClipToDamage(const SDL_Rect* clip) noexcept;
+    Status RestoreClip() noexcept;
+    Status ClearDamage() noexcept;
+    Status PresentDamage() noexcept;
+    Status SubmitGeometry(SDL_Texture* texture,
+        const SDL_Vertex* vertices, int num_vertices,
+        const int* indices, int num_indices) noexcept;
+    void ResyncView();
+    Status CheckView() noexcept;
+    bool OnDefaultTarget() const;
+    Rect ViewportBounds() const;
+
     RendererPtr renderer_;
+    DrawBuffer draw_buffer_;
+    SpriteBatch batch_;
+    bool deferred_ = false;
+    int layer_ = 0;
+    bool cull_ = false;
+    State state_;
+    detail::StatsCollector stats_;
+    bool dirty_rects_ = false;
+    // set while a call is replayed once per damaged rect
+    bool damage_pass_ = false;
+    // SDL's clip rect holds damage_clip_ rather than state_.clip_rect
+    bool damage_clipped_ = false;
+    std::optional<Rect> damage_clip_;
+    DamageRegion damage_;
 };
 
 Texture CreateTexture(Renderer& renderer, Uint32 format, int access, int w, int h);
@@ -0,0 +1,103 @@
+#ifndef SDL2WRAPPER_RENDERERSTATS_H_
+#define SDL2WRAPPER_RENDERERSTATS_H_
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_render.h"
+
+namespace sdl2
+{
+
+// Per-frame counters kept by Renderer when built with SDL2WRAPPER_STATS.
+// Without the define every field stays zero and nothing is measured, except
+// culled and submitted, which culling always keeps.
+struct RendererStats
+{
+    // SDL draw calls by kind
+    Uint64 copies = 0;
+    Uint64 geometry = 0;
+    Uint64 points = 0;
+    Uint64 lines = 0;
+    Uint64 rects = 0;
+    Uint64 fills = 0;
+    Uint64 clears = 0;
+    Uint64 readbacks = 0;
+
+    // draw calls checked while culling is on, by outcome
+    Uint64 culled = 0;
+    Uint64 submitted = 0;
+
+    Uint64 texture_switches = 0;
+    Uint64 state_changes = 0;
+    Uint64 vertices = 0;
+    Uint64 texture_locks = 0;
+    Uint64 texture_unlocks = 0;
+
+    // wall time spent inside SDL per API group
+    double copy_seconds = 0.0;
+    double geometry_seconds = 0.0;
+    double primitive_seconds = 0.0;
+    double state_seconds = 0.0;
+    double readback_seconds = 0.0;
+    double present_seconds = 0.0;
+};
+
+namespace detail
+{
+
+class StatsCollector
+{
+public:
+    StatsCollector();
+
+    RendererStats& Current();
+    const RendererStats& Current() const;
+    const RendererStats& Frame() const;
+
+    void BindTexture(SDL_Texture* texture);
+    void EndFrame();
+
+private:
+    RendererStats current_;
+    RendererStats frame_;
+    SDL_Texture* texture_;
+    Uint64 locks_base_;
+    Uint64 unlocks_base_;
+};
+
+#ifdef SDL2WRAPPER_STATS
+
+class StatsTimer
+{
+public:
+    explicit StatsTimer(double& seconds);
+    ~StatsTimer();
+
+    StatsTimer(const StatsTimer&) = delete;
+    StatsTimer& operator=(const StatsTimer&) = delete;
+
+private:
+    double& seconds_;
+    Uint64 start_;
+};
+
+void CountTextureLock();
+void CountTextureUnlock();
+
+#endif
+
+} // detail
+
+} // sdl2
+
+#ifdef SDL2WRAPPER_STATS
+    #define SDL2WRAPPER_STATS_ADD(collector, field, n) ((collector).Current().field += (n))
+    #define SDL2WRAPPER_STATS_TEXTURE(collector, texture) ((collector).BindTexture(texture))
+    #define SDL2WRAPPER_STATS_TIME(collector, field) \
+        ::sdl2::detail::StatsTimer sdl2wrapper_stats_timer_((collector).Current().field)
+#else
+    #define SDL2WRAPPER_STATS_ADD(collector, field, n) ((void)0)
+    #define SDL2WRAPPER_STATS_TEXTURE(collector, texture) ((void)0)
+    #define SDL2WRAPPER_STATS_TIME(collector, field) ((void)0)
+#endif
+
+#endif
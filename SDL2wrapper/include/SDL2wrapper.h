@@ -3,16 +3,27 @@
 
 #include "SDL2wrapper/include/SDL.h"
 #include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/Status.h"
 
 #include "SDL2wrapper/include/Window.h"
 
 #include "SDL2wrapper/include/Renderer.h"
 #include "SDL2wrapper/include/Surface.h"
 #include "SDL2wrapper/include/Texture.h"
+#include "SDL2wrapper/include/Mesh.h"
+#include "SDL2wrapper/include/RenderTargetPool.h"
+#include "SDL2wrapper/include/AsyncReadback.h"
+#include "SDL2wrapper/include/StreamingTexture.h"
 #include "SDL2wrapper/include/Color.h"
 
 #include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectArray.h"
+#include "SDL2wrapper/include/RectIndex.h"
+#include "SDL2wrapper/include/RectRegion.h"
+#include "SDL2wrapper/include/LineClip.h"
 #include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/FPoint.h"
 
 #ifdef SDL2WRAPPER_IMAGE
 #include "SDL2wrapper/include/SDLImage.h"
@@ -0,0 +1,74 @@
+#ifndef SDL2WRAPPER_SPRITEBATCH_H_
+#define SDL2WRAPPER_SPRITEBATCH_H_
+
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+struct CopyCommand
+{
+    Rect srcrect;
+    Rect dstrect;
+};
+
+// Reusable vertex/index buffer of textured quads drawn with a single
+// SDL_RenderGeometry call by Renderer::Draw. As with SDL_RenderGeometry, the
+// texture color and alpha modulation is not applied; per-sprite color is.
+class SpriteBatch
+{
+public:
+    SpriteBatch();
+    explicit SpriteBatch(Texture& texture);
+
+    SpriteBatch(SpriteBatch&& other) noexcept = default;
+    SpriteBatch& operator=(SpriteBatch&& other) noexcept = default;
+
+    SpriteBatch(const SpriteBatch& other) = delete;
+    SpriteBatch& operator=(const SpriteBatch& other) = delete;
+
+    SpriteBatch& Reset(Texture& texture);
+    SpriteBatch& Clear();
+    SpriteBatch& Reserve(int count);
+
+    SpriteBatch& Add(const Rect& srcrect, const Rect& dstrect);
+    SpriteBatch& Add(const Rect& srcrect, const Rect& dstrect, const Color& color);
+    SpriteBatch& Add(const Rect& srcrect, const Rect& dstrect, const Color& color, int flip);
+    SpriteBatch& Add(const Rect& srcrect, const FRect& dstrect);
+    SpriteBatch& Add(const Rect& srcrect, const FRect& dstrect, const Color& color);
+    SpriteBatch& Add(const Rect& srcrect, const FRect& dstrect, const Color& color, int flip);
+    SpriteBatch& Add(const CopyCommand* commands, int count);
+    SpriteBatch& Add(const CopyCommand* commands, int count, const Color& color);
+
+    SDL_Texture* GetTexture() const;
+    int Size() const;
+    bool Empty() const;
+
+    const SDL_Vertex* Vertices() const;
+    int VertexCount() const;
+    const int* Indices() const;
+    int IndexCount() const;
+
+private:
+    void AddQuad(const SDL_Rect& srcrect, const SDL_FRect& dstrect, const SDL_Color& color, int flip);
+
+    SDL_Texture* texture_;
+    float inv_width_;
+    float inv_height_;
+    int width_;
+    int height_;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+};
+
+} // sdl2
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef SDL2WRAPPER_STATUS_H_
+#define SDL2WRAPPER_STATUS_H_
+
+#include "SDL2wrapper/include/Exception.h"
+
+namespace sdl2
+{
+
+// Result of the non-throwing Try* calls. A failed Status only remembers the
+// name of the SDL function that failed; the message stays in SDL_GetError()
+// until somebody asks for it.
+class Status
+{
+public:
+    constexpr Status() noexcept : function_(nullptr)
+    {}
+    // function must be a string literal
+    constexpr explicit Status(const char* function) noexcept : function_(function)
+    {}
+
+    constexpr bool Ok() const noexcept
+    {
+        return function_ == nullptr;
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return function_ == nullptr;
+    }
+
+    // nullptr when Ok()
+    constexpr const char* Function() const noexcept
+    {
+        return function_;
+    }
+
+    // SDL_GetError(), only meaningful right after the failure
+    const char* Error() const noexcept;
+
+private:
+    const char* function_;
+};
+
+inline void ThrowIfFailed(const Status& status)
+{
+    if (!status.Ok())
+        ThrowSDLException(status.Function());
+}
+
+} // sdl2
+
+#endif
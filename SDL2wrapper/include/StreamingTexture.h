@@ -0,0 +1,120 @@
+#ifndef SDL2WRAPPER_STREAMINGTEXTURE_H_
+#define SDL2WRAPPER_STREAMINGTEXTURE_H_
+
+#include <atomic>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_pixels.h"
+
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Status.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+// A streaming texture fed from other threads through a ring of CPU staging
+// buffers. Producers, on any thread, take a free slot with Acquire(), write
+// it and publish it by dropping the handle. The render thread calls
+// Upload() before drawing; it uploads the newest published slot, if there
+// is one newer than the texture, and never waits for a producer.
+//
+//     StreamingTexture video(renderer, SDL_PIXELFORMAT_ARGB8888, 640, 480);
+//
+//     // decoder thread
+//     if (StreamingTexture::WriteHandle slot = video.Acquire())
+//         Decode(slot.Pixels(), slot.Pitch());
+//
+//     // render thread
+//     renderer.Copy(video.Upload());
+//
+// Slots change hands with atomic compare-and-swap only. When no slot is
+// free, Acquire() reuses the oldest published slot as long as a newer one
+// is waiting; otherwise it returns an empty handle and the producer skips
+// the frame. Packed pixel formats only. Producers must be done before the
+// StreamingTexture goes away.
+class StreamingTexture
+{
+public:
+    class WriteHandle
+    {
+        friend class StreamingTexture;
+
+        WriteHandle(StreamingTexture* owner, int slot);
+    public:
+        WriteHandle();
+        // publishes the slot
+        ~WriteHandle();
+
+        WriteHandle(WriteHandle&& other) noexcept;
+        WriteHandle& operator=(WriteHandle&& other) noexcept;
+
+        WriteHandle(const WriteHandle& other) = delete;
+        WriteHandle& operator=(const WriteHandle& other) = delete;
+
+        // false for an empty handle
+        explicit operator bool() const;
+
+        // nullptr for an empty handle
+        void* Pixels() const;
+        int Pitch() const;
+    private:
+        StreamingTexture* owner_;
+        int slot_;
+    };
+
+    StreamingTexture(Renderer& renderer, Uint32 format, int w, int h, int slots = 3);
+
+    StreamingTexture(const StreamingTexture& other) = delete;
+    StreamingTexture& operator=(const StreamingTexture& other) = delete;
+
+    StreamingTexture(StreamingTexture&& other) = delete;
+    StreamingTexture& operator=(StreamingTexture&& other) = delete;
+
+    // any thread
+    WriteHandle Acquire() noexcept;
+
+    // render thread
+    Texture& Upload();
+    Status TryUpload() noexcept;
+
+    Texture& Get();
+    int Slots() const;
+    int Pitch() const;
+
+    // frames published so far, any thread
+    Uint64 Published() const;
+    // the published frame in the texture, counting from 1; 0 before the first
+    Uint64 Frame() const;
+
+private:
+    enum State
+    {
+        kFree,
+        kWriting,
+        kReady,
+        kUploading,
+    };
+
+    struct Slot
+    {
+        std::atomic<int> state{kFree};
+        // set before the slot turns kReady
+        std::atomic<Uint64> frame{0};
+        std::vector<Uint8> pixels;
+    };
+
+    bool Claim(int slot, State from, State to) noexcept;
+    void Publish(int slot) noexcept;
+
+    Texture texture_;
+    int pitch_;
+    std::vector<Slot> slots_;
+    std::atomic<Uint64> published_;
+    Uint64 frame_;
+};
+
+} // sdl2
+
+#endif
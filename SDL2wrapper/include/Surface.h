@@ -2,6 +2,7 @@
 #define SDL2WRAPPER_SURFACE_H_
 
 #include <optional>
+#include <vector>
 
 #include "SDL2/include/SDL_stdinc.h"
 #include "SDL2/include/SDL_blendmode.h"
@@ -10,6 +11,7 @@
 #include "SDL2wrapper/include/Point.h"
 #include "SDL2wrapper/include/Color.h"
 #include "SDL2wrapper/include/Pointers.h"
+#include "SDL2wrapper/include/Status.h"
 
 namespace sdl2
 {
@@ -95,6 +97,7 @@ public:
 
     Surface& FillRect(const std::optional<Rect>& rect, Uint32 color);
     Surface& FillRects(const Rect* rects, int count, Uint32 color);
+    Surface& FillRects(const std::vector<Rect>& rects, Uint32 color);
 
     Point Size() const;
     int Width() const;
@@ -102,6 +105,15 @@ public:
 
     Uint32 Format() const;
 
+    // Non-throwing variants, see Renderer. SDL writes the final blit
+    // rectangle back into dstrect.
+    Status TryBlit(const SDL_Rect* srcrect, Surface& dst, SDL_Rect* dstrect) noexcept;
+    Status TryBlitScaled(const SDL_Rect* srcrect, Surface& dst, SDL_Rect* dstrect) noexcept;
+    Status TryFillRect(const SDL_Rect* rect, Uint32 color) noexcept;
+    Status TryFillRects(const Rect* rects, int count, Uint32 color) noexcept;
+    // handle is left untouched on failure
+    Status TryLock(LockHandle& handle) noexcept;
+
 private:
     SurfaceSharedPtr surface_;
 };
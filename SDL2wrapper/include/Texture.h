@@ -12,6 +12,7 @@
 #include "SDL2wrapper/include/Color.h"
 #include "SDL2wrapper/include/Rect.h"
 #include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Status.h"
 
 namespace sdl2
 {
@@ -24,7 +25,7 @@ public:
     {
         friend class Texture;
 
-        LockHandle(Texture* texture, const std::optional<Rect>& rect);
+        LockHandle(Texture* texture, void* pixels, int pitch);
     public:
 
         LockHandle();
@@ -58,6 +59,8 @@ public:
     SDL_Texture* Get() const;
 
     Texture& Update(const std::optional<Rect>& rect, const void* pixels, int pitch);
+    // from the surface origin; a surface of another format is converted
+    // only as far as rect reaches
     Texture& Update(const std::optional<Rect>& rect, Surface& surface);
     Texture& Update(const std::optional<Rect>& rect, Surface&& surface);
 
@@ -86,6 +89,15 @@ public:
     void GetColorMod(Uint8& r, Uint8& g, Uint8& b);
     Color ColorAndAlphaMod();
 
+    // Non-throwing variants, see Renderer.
+    Status TryUpdate(const SDL_Rect* rect, const void* pixels, int pitch) noexcept;
+    Status TryBlendMode(SDL_BlendMode blendMode) noexcept;
+    Status TryAlphaMod(Uint8 alpha) noexcept;
+    Status TrySetColorMod(Uint8 r, Uint8 g, Uint8 b) noexcept;
+    Status TryColorAndAlphaMod(const Color& color) noexcept;
+    // handle is left untouched on failure
+    Status TryLock(LockHandle& handle, const SDL_Rect* rect = nullptr) noexcept;
+
 private:
     TexturePtr texture_;
 };
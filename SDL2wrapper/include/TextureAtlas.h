@@ -0,0 +1,87 @@
+#ifndef SDL2WRAPPER_TEXTUREATLAS_H_
+#define SDL2WRAPPER_TEXTUREATLAS_H_
+
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_pixels.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectPacker.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+// Packs many surfaces into a few large textures ("pages") so sprites share
+// texture bindings and batch together. Surfaces are uploaded as they are
+// inserted and never move afterwards; a page that is full is left alone and
+// a new one is started.
+//
+//     renderer.Copy(atlas.Page(region), region.rect, dst);
+class TextureAtlas
+{
+public:
+    struct Region
+    {
+        int page;
+        Rect rect;
+    };
+
+    // The page size is clamped to the renderer's maximum texture size.
+    // padding keeps neighbouring regions apart to avoid filtering bleed.
+    explicit TextureAtlas(Renderer& renderer,
+        int page_width = 2048, int page_height = 2048, int padding = 1,
+        Uint32 format = SDL_PIXELFORMAT_ARGB8888
+    );
+
+    TextureAtlas(TextureAtlas&& other) = default;
+    TextureAtlas& operator=(TextureAtlas&& other) = default;
+
+    TextureAtlas(const TextureAtlas& other) = delete;
+    TextureAtlas& operator=(const TextureAtlas& other) = delete;
+
+    // nullopt when the surface is larger than a page
+    std::optional<Region> Insert(Surface& surface);
+    // Packs larger surfaces first, which wastes less space than inserting
+    // them one by one. Results are in the order of surfaces.
+    std::vector<std::optional<Region>> Insert(const std::vector<Surface*>& surfaces);
+    // drops every page
+    TextureAtlas& Clear();
+
+    Texture& Page(int index);
+    Texture& Page(const Region& region);
+    int PageCount() const;
+    int PageWidth() const;
+    int PageHeight() const;
+    int Padding() const;
+    Uint32 Format() const;
+    // share of a page in use, padding included
+    double Occupancy(int index) const;
+
+private:
+    struct AtlasPage
+    {
+        Texture texture;
+        RectPacker packer;
+    };
+
+    std::optional<Region> Place(int w, int h);
+    AtlasPage& AddPage();
+
+    Renderer* renderer_;
+    int page_width_;
+    int page_height_;
+    int padding_;
+    Uint32 format_;
+    // deque keeps Page() references valid while pages are added
+    std::deque<AtlasPage> pages_;
+};
+
+} // sdl2
+
+#endif
@@ -0,0 +1,218 @@
+#include "SDL2wrapper/include/AsyncReadback.h"
+
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_mutex.h"
+#include "SDL2/include/SDL_pixels.h"
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Status.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+namespace detail
+{
+
+// one slot stays empty to tell a full queue from an empty one
+IndexQueue::IndexQueue(int capacity) :
+    slots_(capacity + 1), head_(0), tail_(0)
+{}
+
+bool IndexQueue::Push(int value) noexcept
+{
+    const int tail = tail_.load(std::memory_order_relaxed);
+    const int next = (tail + 1) % static_cast<int>(slots_.size());
+    if (next == head_.load(std::memory_order_acquire))
+        return false;
+
+    slots_[tail] = value;
+    tail_.store(next, std::memory_order_release);
+    return true;
+}
+
+bool IndexQueue::Pop(int& value) noexcept
+{
+    const int head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+        return false;
+
+    value = slots_[head];
+    head_.store((head + 1) % static_cast<int>(slots_.size()), std::memory_order_release);
+    return true;
+}
+
+} // detail
+
+AsyncReadback::AsyncReadback(Renderer& renderer, int w, int h, Consumer consumer,
+    int depth, Uint32 format) :
+    renderer_(renderer), w_(w), h_(h), format_(format),
+    pitch_(w * SDL_BYTESPERPIXEL(format)), consumer_(std::move(consumer)),
+    captured_(0), read_(0), dropped_(0), held_(-1),
+    buffers_(depth, std::vector<Uint8>(static_cast<size_t>(pitch_) * h)),
+    buffer_frames_(depth, 0),
+    free_(depth), filled_(depth),
+    wake_(nullptr)
+{
+    assert(depth > 0);
+    staging_.reserve(depth);
+    for (int i = 0; i < depth; ++i)
+    {
+        staging_.push_back(CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, w, h));
+        free_.Push(i);
+    }
+
+    wake_ = SDL_CreateSemaphore(0);
+    if (wake_ == nullptr)
+    {
+        ThrowSDLException("SDL_CreateSemaphore");
+    }
+    worker_ = std::thread(&AsyncReadback::Work, this);
+}
+
+AsyncReadback::~AsyncReadback()
+{
+    SDL_SemPost(wake_);
+    worker_.join();
+    SDL_DestroySemaphore(wake_);
+}
+
+AsyncReadback& AsyncReadback::Capture(Texture& frame)
+{
+    ThrowIfFailed(TryCapture(frame));
+    return *this;
+}
+
+AsyncReadback& AsyncReadback::Flush()
+{
+    ThrowIfFailed(TryFlush());
+    return *this;
+}
+
+Status AsyncReadback::TryCapture(Texture& frame) noexcept
+{
+    Status status;
+    // the oldest staged frame is about to be overwritten
+    if (captured_ - read_ == staging_.size())
+        status = ReadBack(read_);
+    if (status)
+        status = StageCopy(frame, staging_[captured_ % staging_.size()]);
+    if (status)
+        ++captured_;
+
+    Status restored = renderer_.TryTarget(nullptr);
+    return status ? restored : status;
+}
+
+Status AsyncReadback::TryFlush() noexcept
+{
+    Status status;
+    while (status && read_ < captured_)
+        status = ReadBack(read_);
+
+    Status restored = renderer_.TryTarget(nullptr);
+    return status ? restored : status;
+}
+
+int AsyncReadback::Depth() const
+{
+    return static_cast<int>(staging_.size());
+}
+
+Uint64 AsyncReadback::Captured() const
+{
+    return captured_;
+}
+
+Uint64 AsyncReadback::Dropped() const
+{
+    return dropped_;
+}
+
+Status AsyncReadback::ReadBack(Uint64 frame) noexcept
+{
+    read_ = frame + 1;
+    if (held_ < 0 && !free_.Pop(held_))
+    {
+        ++dropped_;
+        return Status();
+    }
+
+    Status status = renderer_.TryTarget(&staging_[frame % staging_.size()]);
+    if (status)
+        status = renderer_.TryReadPixels(nullptr, format_, buffers_[held_].data(), pitch_);
+    if (!status)
+        return status;
+
+    buffer_frames_[held_] = frame;
+    filled_.Push(held_);
+    held_ = -1;
+    SDL_SemPost(wake_);
+    return Status();
+}
+
+// copies frame as it is, whatever its blend mode and modulation
+Status AsyncReadback::StageCopy(Texture& frame, Texture& staging) noexcept
+{
+    SDL_Texture* texture = frame.Get();
+    SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+    Color mod(255, 255, 255, 255);
+    SDL_GetTextureBlendMode(texture, &blend);
+    SDL_GetTextureColorMod(texture, &mod.r, &mod.g, &mod.b);
+    SDL_GetTextureAlphaMod(texture, &mod.a);
+    const bool plain = blend == SDL_BLENDMODE_NONE && mod == Color(255, 255, 255, 255);
+
+    Status status;
+    if (!plain)
+    {
+        status = frame.TryBlendMode(SDL_BLENDMODE_NONE);
+        if (status)
+            status = frame.TryColorAndAlphaMod(Color(255, 255, 255, 255));
+    }
+    if (status)
+        status = renderer_.TryTarget(&staging);
+    if (status)
+        status = renderer_.TryCopy(frame, nullptr, nullptr);
+    // a deferred copy must be submitted while the modes above are set
+    if (status)
+        status = renderer_.TryFlush();
+
+    if (!plain)
+    {
+        Status restored = frame.TryBlendMode(blend);
+        if (restored)
+            restored = frame.TryColorAndAlphaMod(mod);
+        if (status)
+            status = restored;
+    }
+    return status;
+}
+
+void AsyncReadback::Work()
+{
+    for (;;)
+    {
+        SDL_SemWait(wake_);
+        int buffer;
+        // woken with nothing queued: the destructor wants us to stop
+        if (!filled_.Pop(buffer))
+            return;
+
+        consumer_(ReadbackFrame{
+            buffer_frames_[buffer], w_, h_, format_, pitch_, buffers_[buffer].data()
+        });
+        free_.Push(buffer);
+    }
+}
+
+} // sdl2
@@ -0,0 +1,332 @@
+#include "SDL2wrapper/include/BakedAtlas.h"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "SDL2/include/SDL_error.h"
+#include "SDL2/include/SDL_pixels.h"
+#include "SDL2/include/SDL_rwops.h"
+
+#include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/MappedFile.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectPacker.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+namespace
+{
+
+constexpr Uint32 kPageFormat = SDL_PIXELFORMAT_ARGB8888;
+constexpr std::size_t kPixelAlignment = 16;
+
+std::size_t Align(std::size_t offset)
+{
+    return (offset + kPixelAlignment - 1) / kPixelAlignment * kPixelAlignment;
+}
+
+class Writer
+{
+public:
+    explicit Writer(const std::string& path) :
+        rw_(SDL_RWFromFile(path.c_str(), "wb")), offset_(0)
+    {
+        if (rw_ == nullptr)
+            ThrowSDLException("SDL_RWFromFile");
+    }
+
+    ~Writer()
+    {
+        if (rw_ != nullptr)
+            SDL_RWclose(rw_);
+    }
+
+    void Write(const void* data, std::size_t size)
+    {
+        if (size > 0 && SDL_RWwrite(rw_, data, size, 1) != 1)
+            ThrowSDLException("SDL_RWwrite");
+        offset_ += size;
+    }
+
+    void PadTo(std::size_t offset)
+    {
+        static const Uint8 zeros[kPixelAlignment] = {};
+        assert(offset >= offset_ && offset - offset_ <= kPixelAlignment);
+        Write(zeros, offset - offset_);
+    }
+
+    void Close()
+    {
+        SDL_RWops* rw = rw_;
+        rw_ = nullptr;
+        if (SDL_RWclose(rw) != 0)
+            ThrowSDLException("SDL_RWclose");
+    }
+
+private:
+    SDL_RWops* rw_;
+    std::size_t offset_;
+};
+
+[[noreturn]] void ThrowBadAtlas(const std::string& path, const char* reason)
+{
+    SDL_SetError("%s: %s", path.c_str(), reason);
+    ThrowSDLException("BakedAtlas");
+}
+
+} // namespace
+
+AtlasBaker::AtlasBaker(int page_width, int page_height, int padding) :
+    page_width_(page_width), page_height_(page_height), padding_(std::max(padding, 0))
+{}
+
+AtlasBaker& AtlasBaker::Add(const std::string& name, Surface&& surface)
+{
+    sprites_.push_back(Sprite{name, std::move(surface)});
+    return *this;
+}
+
+int AtlasBaker::Size() const
+{
+    return static_cast<int>(sprites_.size());
+}
+
+void AtlasBaker::Write(const std::string& path)
+{
+    // larger sprites first, see TextureAtlas::Insert
+    std::vector<int> order(sprites_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        const Surface& sa = sprites_[a].surface;
+        const Surface& sb = sprites_[b].surface;
+        return std::max(sa.Width(), sa.Height()) > std::max(sb.Width(), sb.Height());
+    });
+
+    std::vector<RectPacker> packers;
+    std::vector<Point> extents;
+    std::vector<detail::AtlasEntry> entries(sprites_.size());
+    for (int i : order)
+    {
+        const Surface& surface = sprites_[i].surface;
+        const int w = surface.Width();
+        const int h = surface.Height();
+        if (w > page_width_ || h > page_height_)
+        {
+            SDL_SetError("%s is %dx%d, larger than a %dx%d page",
+                sprites_[i].name.c_str(), w, h, page_width_, page_height_);
+            ThrowSDLException("AtlasBaker::Write");
+        }
+
+        std::optional<Rect> r;
+        std::size_t page = 0;
+        for (; page < packers.size() && r == std::nullopt; ++page)
+            r = packers[page].Insert(w + padding_, h + padding_);
+        if (r == std::nullopt)
+        {
+            packers.emplace_back(page_width_ + padding_, page_height_ + padding_);
+            extents.emplace_back(0, 0);
+            r = packers.back().Insert(w + padding_, h + padding_);
+            page = packers.size();
+        }
+        --page;
+
+        extents[page].x = std::max(extents[page].x, r->x + w);
+        extents[page].y = std::max(extents[page].y, r->y + h);
+        entries[i] = detail::AtlasEntry{0, 0, static_cast<Uint32>(page), r->x, r->y, w, h, 0};
+    }
+
+    // the index is sorted by name for binary search
+    std::vector<int> by_name(sprites_.size());
+    std::iota(by_name.begin(), by_name.end(), 0);
+    std::sort(by_name.begin(), by_name.end(), [this](int a, int b) {
+        return sprites_[a].name < sprites_[b].name;
+    });
+
+    std::string names;
+    std::vector<detail::AtlasEntry> index;
+    index.reserve(entries.size());
+    for (int i : by_name)
+    {
+        detail::AtlasEntry entry = entries[i];
+        entry.name_offset = static_cast<Uint32>(names.size());
+        entry.name_size = static_cast<Uint32>(sprites_[i].name.size());
+        names += sprites_[i].name;
+        index.push_back(entry);
+    }
+
+    detail::AtlasHeader header = {};
+    std::memcpy(header.magic, detail::kAtlasMagic, sizeof(header.magic));
+    header.version = detail::kAtlasVersion;
+    header.byte_order = detail::kAtlasByteOrder;
+    header.format = kPageFormat;
+    header.page_count = static_cast<Uint32>(packers.size());
+    header.entry_count = static_cast<Uint32>(index.size());
+    header.names_size = static_cast<Uint32>(names.size());
+
+    std::vector<detail::AtlasPage> pages(packers.size());
+    std::size_t offset = Align(sizeof(header) +
+        pages.size() * sizeof(detail::AtlasPage) +
+        index.size() * sizeof(detail::AtlasEntry) +
+        names.size());
+    for (std::size_t p = 0; p < pages.size(); ++p)
+    {
+        pages[p].width = static_cast<Uint32>(extents[p].x);
+        pages[p].height = static_cast<Uint32>(extents[p].y);
+        pages[p].pitch = pages[p].width * SDL_BYTESPERPIXEL(kPageFormat);
+        pages[p].reserved = 0;
+        pages[p].offset = offset;
+        offset = Align(offset + static_cast<std::size_t>(pages[p].pitch) * pages[p].height);
+    }
+
+    Writer writer(path);
+    writer.Write(&header, sizeof(header));
+    writer.Write(pages.data(), pages.size() * sizeof(detail::AtlasPage));
+    writer.Write(index.data(), index.size() * sizeof(detail::AtlasEntry));
+    writer.Write(names.data(), names.size());
+
+    for (std::size_t p = 0; p < pages.size(); ++p)
+    {
+        writer.PadTo(pages[p].offset);
+
+        Surface page(0, pages[p].width, pages[p].height, 32,
+            0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+        page.FillRect(std::nullopt, 0);
+        for (std::size_t i = 0; i < sprites_.size(); ++i)
+        {
+            if (entries[i].page != p)
+                continue;
+            // copy alpha as is instead of blending it onto the page
+            Surface& sprite = sprites_[i].surface;
+            sprite.BlendMode(SDL_BLENDMODE_NONE);
+            sprite.Blit(std::nullopt, page, Rect(entries[i].x, entries[i].y, entries[i].w, entries[i].h));
+        }
+
+        Surface::LockHandle lock = page.Lock();
+        const Uint8* pixels = static_cast<const Uint8*>(lock.Pixels());
+        for (Uint32 y = 0; y < pages[p].height; ++y)
+            writer.Write(pixels + static_cast<std::size_t>(y) * lock.Pitch(), pages[p].pitch);
+    }
+    writer.Close();
+}
+
+BakedAtlas::BakedAtlas(Renderer& renderer, const std::string& path) :
+    file_(path), entries_(nullptr), entry_count_(0), names_(nullptr)
+{
+    const Uint8* data = file_.Data();
+    const std::size_t size = file_.Size();
+
+    detail::AtlasHeader header;
+    if (size < sizeof(header))
+        ThrowBadAtlas(path, "truncated header");
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, detail::kAtlasMagic, sizeof(header.magic)) != 0)
+        ThrowBadAtlas(path, "not a baked atlas");
+    if (header.version != detail::kAtlasVersion || header.byte_order != detail::kAtlasByteOrder)
+        ThrowBadAtlas(path, "unsupported version or byte order");
+    if (header.format != kPageFormat)
+        ThrowBadAtlas(path, "unsupported pixel format");
+
+    const std::size_t pages_offset = sizeof(header);
+    const std::size_t entries_offset = pages_offset + header.page_count * sizeof(detail::AtlasPage);
+    const std::size_t names_offset = entries_offset + header.entry_count * sizeof(detail::AtlasEntry);
+    if (names_offset + header.names_size > size)
+        ThrowBadAtlas(path, "truncated index");
+
+    // the header keeps every table 8-byte aligned within the mapping
+    const detail::AtlasPage* pages = reinterpret_cast<const detail::AtlasPage*>(data + pages_offset);
+    entries_ = reinterpret_cast<const detail::AtlasEntry*>(data + entries_offset);
+    entry_count_ = static_cast<int>(header.entry_count);
+    names_ = reinterpret_cast<const char*>(data + names_offset);
+
+    for (int i = 0; i < entry_count_; ++i)
+    {
+        if (entries_[i].page >= header.page_count ||
+            entries_[i].name_offset + static_cast<std::size_t>(entries_[i].name_size) > header.names_size)
+            ThrowBadAtlas(path, "corrupt index");
+    }
+
+    pages_.reserve(header.page_count);
+    for (Uint32 p = 0; p < header.page_count; ++p)
+    {
+        const detail::AtlasPage& page = pages[p];
+        const Uint64 row = static_cast<Uint64>(page.width) * SDL_BYTESPERPIXEL(header.format);
+        if (page.width > INT_MAX || page.height > INT_MAX || page.pitch > INT_MAX || page.pitch < row)
+            ThrowBadAtlas(path, "corrupt page");
+        // both factors are 32-bit, so the product cannot wrap
+        const Uint64 bytes = static_cast<Uint64>(page.pitch) * page.height;
+        if (page.offset > size || bytes > size - page.offset)
+            ThrowBadAtlas(path, "truncated page");
+
+        Texture texture = CreateTexture(renderer, header.format, SDL_TEXTUREACCESS_STATIC,
+            static_cast<int>(page.width), static_cast<int>(page.height));
+        texture.BlendMode(SDL_BLENDMODE_BLEND);
+        texture.Update(std::nullopt, data + page.offset, static_cast<int>(page.pitch));
+        pages_.push_back(std::move(texture));
+    }
+}
+
+std::optional<TextureAtlas::Region> BakedAtlas::Find(std::string_view name) const
+{
+    int lo = 0;
+    int hi = entry_count_;
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        std::string_view candidate = Name(mid);
+        if (candidate < name)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == entry_count_ || Name(lo) != name)
+        return std::nullopt;
+    return Region(lo);
+}
+
+int BakedAtlas::Size() const
+{
+    return entry_count_;
+}
+
+std::string_view BakedAtlas::Name(int index) const
+{
+    assert(index >= 0 && index < entry_count_);
+    return std::string_view(names_ + entries_[index].name_offset, entries_[index].name_size);
+}
+
+TextureAtlas::Region BakedAtlas::Region(int index) const
+{
+    assert(index >= 0 && index < entry_count_);
+    const detail::AtlasEntry& e = entries_[index];
+    return TextureAtlas::Region{static_cast<int>(e.page), Rect(e.x, e.y, e.w, e.h)};
+}
+
+Texture& BakedAtlas::Page(int index)
+{
+    assert(index >= 0 && index < PageCount());
+    return pages_[index];
+}
+
+Texture& BakedAtlas::Page(const TextureAtlas::Region& region)
+{
+    return Page(region.page);
+}
+
+int BakedAtlas::PageCount() const
+{
+    return static_cast<int>(pages_.size());
+}
+
+} // sdl2
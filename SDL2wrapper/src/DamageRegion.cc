@@ -0,0 +1,146 @@
+#include "SDL2wrapper/include/DamageRegion.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+namespace
+{
+
+long long Area(const Rect& rect)
+{
+    return static_cast<long long>(rect.w) * rect.h;
+}
+
+// area a union would cover that neither rectangle does
+long long Waste(const Rect& a, const Rect& b)
+{
+    return Area(a.Union(b)) - Area(a) - Area(b);
+}
+
+// merging costs overdraw; a quarter of the merged area is worth one
+// rectangle less to clip and present
+bool ShouldMerge(const Rect& a, const Rect& b)
+{
+    return a.Intersects(b) || Waste(a, b) * 4 <= Area(a) + Area(b);
+}
+
+} // namespace
+
+DamageRegion::DamageRegion(int max_rects) :
+    max_rects_(std::max(max_rects, 1))
+{}
+
+DamageRegion& DamageRegion::Add(const Rect& rect)
+{
+    if (rect.w <= 0 || rect.h <= 0)
+        return *this;
+
+    Merge(rect);
+
+    while (static_cast<int>(rects_.size()) > max_rects_)
+    {
+        std::size_t best_a = 0;
+        std::size_t best_b = 1;
+        long long best = std::numeric_limits<long long>::max();
+        for (std::size_t a = 0; a < rects_.size(); ++a)
+        {
+            for (std::size_t b = a + 1; b < rects_.size(); ++b)
+            {
+                long long growth = Waste(rects_[a], rects_[b]);
+                if (growth < best)
+                {
+                    best = growth;
+                    best_a = a;
+                    best_b = b;
+                }
+            }
+        }
+        Rect merged = rects_[best_a].Union(rects_[best_b]);
+        rects_.erase(rects_.begin() + best_b);
+        rects_.erase(rects_.begin() + best_a);
+        Merge(merged);
+    }
+    return *this;
+}
+
+void DamageRegion::Merge(Rect rect)
+{
+    // a merged rectangle can reach new neighbours, so keep going until it
+    // is disjoint from everything left
+    for (std::size_t i = 0; i < rects_.size();)
+    {
+        if (rects_[i].Contains(rect))
+            return;
+        if (ShouldMerge(rects_[i], rect))
+        {
+            rect.MakeUnionWith(rects_[i]);
+            rects_[i] = rects_.back();
+            rects_.pop_back();
+            i = 0;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    rects_.push_back(rect);
+}
+
+DamageRegion& DamageRegion::Clear()
+{
+    rects_.clear();
+    return *this;
+}
+
+bool DamageRegion::Empty() const
+{
+    return rects_.empty();
+}
+
+bool DamageRegion::Intersects(const Rect& rect) const
+{
+    for (const Rect& r : rects_)
+    {
+        if (r.Intersects(rect))
+            return true;
+    }
+    return false;
+}
+
+const std::vector<Rect>& DamageRegion::Rects() const
+{
+    return rects_;
+}
+
+Rect DamageRegion::Bounds() const
+{
+    if (rects_.empty())
+        return Rect();
+
+    Rect bounds = rects_.front();
+    for (const Rect& r : rects_)
+        bounds.MakeUnionWith(r);
+    return bounds;
+}
+
+long long DamageRegion::Area() const
+{
+    long long area = 0;
+    for (const Rect& r : rects_)
+        area += sdl2::Area(r);
+    return area;
+}
+
+int DamageRegion::MaxRects() const
+{
+    return max_rects_;
+}
+
+} // sdl2
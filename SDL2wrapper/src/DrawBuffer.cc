@@ -0,0 +1,307 @@
+#include "SDL2wrapper/include/DrawBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RendererStats.h"
+#include "SDL2wrapper/include/Status.h"
+
+namespace sdl2
+{
+
+namespace
+{
+
+// how many batches back a quad may travel to find a compatible one
+constexpr std::size_t kBatchLookback = 64;
+
+constexpr int kQuadIndices[6] = {0, 1, 2, 0, 2, 3};
+
+constexpr double kPi = 3.14159265358979323846;
+
+} // namespace
+
+DrawBuffer::DrawBuffer()
+{}
+
+Status DrawBuffer::AddCopy(SDL_Texture* texture,
+    const SDL_Rect* srcrect, const SDL_FRect& dstrect,
+    double angle, const SDL_FPoint* center, int flip, int layer)
+{
+    if (dstrect.w <= 0.0f || dstrect.h <= 0.0f)
+        return Status();
+
+    int tw, th;
+    if (0 != SDL_QueryTexture(texture, nullptr, nullptr, &tw, &th))
+    {
+        return Status("SDL_QueryTexture");
+    }
+
+    SDL_Rect src = {0, 0, tw, th};
+    if (srcrect != nullptr)
+    {
+        SDL_Rect full = src;
+        if (SDL_TRUE != SDL_IntersectRect(srcrect, &full, &src))
+            return Status();
+    }
+
+    Command cmd;
+    cmd.texture = texture;
+    cmd.layer = layer;
+
+    // SDL_RenderGeometry ignores texture color and alpha modulation, so it is
+    // baked into the vertex colors at record time
+    SDL_Color mod;
+    if (0 != SDL_GetTextureColorMod(texture, &mod.r, &mod.g, &mod.b))
+    {
+        return Status("SDL_GetTextureColorMod");
+    }
+    if (0 != SDL_GetTextureAlphaMod(texture, &mod.a))
+    {
+        return Status("SDL_GetTextureAlphaMod");
+    }
+    if (0 != SDL_GetTextureBlendMode(texture, &cmd.blend))
+    {
+        return Status("SDL_GetTextureBlendMode");
+    }
+
+    float u0 = static_cast<float>(src.x) / tw;
+    float v0 = static_cast<float>(src.y) / th;
+    float u1 = static_cast<float>(src.x + src.w) / tw;
+    float v1 = static_cast<float>(src.y + src.h) / th;
+    if (flip & SDL_FLIP_HORIZONTAL)
+        std::swap(u0, u1);
+    if (flip & SDL_FLIP_VERTICAL)
+        std::swap(v0, v1);
+
+    float x0 = dstrect.x;
+    float y0 = dstrect.y;
+    float x1 = dstrect.x + dstrect.w;
+    float y1 = dstrect.y + dstrect.h;
+
+    cmd.vertices[0] = {{x0, y0}, mod, {u0, v0}};
+    cmd.vertices[1] = {{x1, y0}, mod, {u1, v0}};
+    cmd.vertices[2] = {{x1, y1}, mod, {u1, v1}};
+    cmd.vertices[3] = {{x0, y1}, mod, {u0, v1}};
+    cmd.bounds = FRect(dstrect).Enclosing();
+
+    if (angle != 0.0)
+    {
+        float cx = x0 + (center == nullptr ? dstrect.w / 2.0f : center->x);
+        float cy = y0 + (center == nullptr ? dstrect.h / 2.0f : center->y);
+        double radians = angle * kPi / 180.0;
+        float s = static_cast<float>(std::sin(radians));
+        float c = static_cast<float>(std::cos(radians));
+
+        float minx = cx, miny = cy, maxx = cx, maxy = cy;
+        for (SDL_Vertex& v : cmd.vertices)
+        {
+            float dx = v.position.x - cx;
+            float dy = v.position.y - cy;
+            v.position.x = cx + dx * c - dy * s;
+            v.position.y = cy + dx * s + dy * c;
+            minx = std::min(minx, v.position.x);
+            miny = std::min(miny, v.position.y);
+            maxx = std::max(maxx, v.position.x);
+            maxy = std::max(maxy, v.position.y);
+        }
+        cmd.bounds = FRect::FromCorners(minx, miny, maxx, maxy).Enclosing();
+    }
+
+    commands_.push_back(cmd);
+    return Status();
+}
+
+bool DrawBuffer::AddFill(const SDL_FRect& rect, const Color& color, SDL_BlendMode blend, int layer)
+{
+    if (rect.w <= 0.0f || rect.h <= 0.0f)
+        return false;
+
+    float x0 = rect.x;
+    float y0 = rect.y;
+    float x1 = rect.x + rect.w;
+    float y1 = rect.y + rect.h;
+
+    Command cmd;
+    cmd.texture = nullptr;
+    cmd.blend = blend;
+    cmd.layer = layer;
+    cmd.bounds = FRect(rect).Enclosing();
+    cmd.vertices[0] = {{x0, y0}, color, {0.0f, 0.0f}};
+    cmd.vertices[1] = {{x1, y0}, color, {0.0f, 0.0f}};
+    cmd.vertices[2] = {{x1, y1}, color, {0.0f, 0.0f}};
+    cmd.vertices[3] = {{x0, y1}, color, {0.0f, 0.0f}};
+
+    commands_.push_back(cmd);
+    return true;
+}
+
+void DrawBuffer::BuildBatches()
+{
+    const int count = static_cast<int>(commands_.size());
+
+    order_.resize(commands_.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    std::stable_sort(order_.begin(), order_.end(), [this](int a, int b) {
+        return commands_[a].layer < commands_[b].layer;
+    });
+
+    batches_.clear();
+    batch_of_.resize(commands_.size());
+
+    std::size_t layer_first = 0;
+    for (int k = 0; k < count; ++k)
+    {
+        const int i = order_[k];
+        const Command& cmd = commands_[i];
+
+        if (k > 0 && cmd.layer != commands_[order_[k - 1]].layer)
+            layer_first = batches_.size();
+
+        std::size_t limit = batches_.size() > kBatchLookback ? batches_.size() - kBatchLookback : 0;
+        limit = std::max(limit, layer_first);
+
+        // walk back over the batches of this layer; the quad may join a
+        // compatible batch only if it overlaps nothing drawn after that batch
+        int target = -1;
+        for (std::size_t b = batches_.size(); b-- > limit; )
+        {
+            const Batch& batch = batches_[b];
+            if (batch.texture == cmd.texture && batch.blend == cmd.blend)
+            {
+                target = static_cast<int>(b);
+                break;
+            }
+            if (batch.bounds.Intersects(cmd.bounds))
+                break;
+        }
+
+        if (target < 0)
+        {
+            batches_.push_back({cmd.texture, cmd.blend, cmd.bounds});
+            target = static_cast<int>(batches_.size()) - 1;
+        }
+        else
+        {
+            batches_[target].bounds.MakeUnionWith(cmd.bounds);
+        }
+        batch_of_[i] = target;
+    }
+
+    // counting sort of commands by batch, stable w.r.t. submission order
+    batch_start_.assign(batches_.size() + 1, 0);
+    for (int i = 0; i < count; ++i)
+        ++batch_start_[batch_of_[i] + 1];
+    for (std::size_t b = 1; b < batch_start_.size(); ++b)
+        batch_start_[b] += batch_start_[b - 1];
+
+    sorted_.resize(commands_.size());
+    for (int k = 0; k < count; ++k)
+    {
+        const int i = order_[k];
+        sorted_[batch_start_[batch_of_[i]]++] = i;
+    }
+
+    // batch_start_ now holds the end of each batch; shift it back
+    for (std::size_t b = batch_start_.size() - 1; b > 0; --b)
+        batch_start_[b] = batch_start_[b - 1];
+    batch_start_[0] = 0;
+}
+
+Status DrawBuffer::Submit(SDL_Renderer* renderer, [[maybe_unused]] detail::StatsCollector& stats,
+    SDL_Texture* texture, SDL_BlendMode blend)
+{
+    SDL_BlendMode previous;
+    if (texture != nullptr)
+        SDL_GetTextureBlendMode(texture, &previous);
+    else
+        SDL_GetRenderDrawBlendMode(renderer, &previous);
+
+    if (previous != blend)
+    {
+        SDL2WRAPPER_STATS_ADD(stats, state_changes, 1);
+        if (texture != nullptr)
+            SDL_SetTextureBlendMode(texture, blend);
+        else
+            SDL_SetRenderDrawBlendMode(renderer, blend);
+    }
+
+    SDL2WRAPPER_STATS_ADD(stats, geometry, 1);
+    SDL2WRAPPER_STATS_ADD(stats, vertices, vertices_.size());
+    SDL2WRAPPER_STATS_TEXTURE(stats, texture);
+    int result;
+    {
+        SDL2WRAPPER_STATS_TIME(stats, geometry_seconds);
+        result = SDL_RenderGeometry(renderer, texture,
+            vertices_.data(), static_cast<int>(vertices_.size()),
+            indices_.data(), static_cast<int>(indices_.size())
+        );
+    }
+
+    if (previous != blend)
+    {
+        if (texture != nullptr)
+            SDL_SetTextureBlendMode(texture, previous);
+        else
+            SDL_SetRenderDrawBlendMode(renderer, previous);
+    }
+
+    if (result != 0)
+    {
+        Clear();
+        return Status("SDL_RenderGeometry");
+    }
+    return Status();
+}
+
+Status DrawBuffer::Flush(SDL_Renderer* renderer, detail::StatsCollector& stats)
+{
+    if (commands_.empty())
+        return Status();
+
+    BuildBatches();
+
+    for (std::size_t b = 0; b < batches_.size(); ++b)
+    {
+        vertices_.clear();
+        indices_.clear();
+        for (int k = batch_start_[b]; k < batch_start_[b + 1]; ++k)
+        {
+            const Command& cmd = commands_[sorted_[k]];
+            const int base = static_cast<int>(vertices_.size());
+            vertices_.insert(vertices_.end(), cmd.vertices, cmd.vertices + 4);
+            for (int index : kQuadIndices)
+                indices_.push_back(base + index);
+        }
+        Status status = Submit(renderer, stats, batches_[b].texture, batches_[b].blend);
+        if (!status)
+            return status;
+    }
+
+    Clear();
+    return Status();
+}
+
+void DrawBuffer::Clear()
+{
+    commands_.clear();
+}
+
+bool DrawBuffer::Empty() const
+{
+    return commands_.empty();
+}
+
+int DrawBuffer::Size() const
+{
+    return static_cast<int>(commands_.size());
+}
+
+} // sdl2
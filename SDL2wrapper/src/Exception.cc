@@ -1,25 +1,38 @@
 #include "SDL2wrapper/include/Exception.h"
 
+#include <cstdlib>
+#include <cstring>
 #include <string>
-#include <sstream>
 
 #include "SDL2/include/SDL.h"
 
+#include "SDL2wrapper/include/Status.h"
+
 namespace sdl2
 {
 
+namespace
+{
+
+const char kSeparator[] = " failed: ";
+
+} // namespace
+
 std::string SDLException::make(const char* function, const char* sdl_error)
 {
     std::string tmp(function);
-    tmp += " failed: ";
+    tmp += kSeparator;
     tmp += sdl_error;
     return tmp;
 }
 
 SDLException::SDLException(const char* function):
-    std::runtime_error(make(function, SDL_GetError())),
-    sdl_function_(function),
-    sdl_error_(SDL_GetError())
+    SDLException(function, SDL_GetError())
+{}
+
+SDLException::SDLException(const char* function, const char* error):
+    std::runtime_error(make(function, error)),
+    error_offset_(std::strlen(function) + sizeof(kSeparator) - 1)
 {}
 
 SDLException::~SDLException() noexcept
@@ -27,13 +40,27 @@ SDLException::~SDLException() noexcept
 
 std::string SDLException::SDLFunction() const
 {
-    return sdl_function_;
+    return std::string(what(), error_offset_ - (sizeof(kSeparator) - 1));
 }
 
 std::string SDLException::SDLError() const
 {
-    return sdl_error_;
+    return what() + error_offset_;
+}
+
+void ThrowSDLException(const char* function)
+{
+#if SDL2WRAPPER_EXCEPTIONS
+    throw SDLException(function);
+#else
+    SDL_LogCritical(SDL_LOG_CATEGORY_ERROR, "%s failed: %s", function, SDL_GetError());
+    std::abort();
+#endif
 }
 
+const char* Status::Error() const noexcept
+{
+    return function_ == nullptr ? "" : SDL_GetError();
+}
 
 }
@@ -0,0 +1,9 @@
+#include "SDL2wrapper/include/FPoint.h"
+
+#include <iostream>
+
+std::ostream& operator<<(std::ostream& os, const sdl2::FPoint& point)
+{
+    os << "[ x:" << point.x << "; y: " << point.y << "]";
+    return os;
+}
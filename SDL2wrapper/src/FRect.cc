@@ -0,0 +1,93 @@
+#include "SDL2wrapper/include/FRect.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+FRect FRect::Union(const FRect& rect) const
+{
+    return FRect::FromCorners(
+            std::min(x, rect.x),
+            std::min(y, rect.y),
+            std::max(X2(), rect.X2()),
+            std::max(Y2(), rect.Y2())
+        );
+}
+
+FRect& FRect::MakeUnionWith(const FRect& rect)
+{
+    *this = Union(rect);
+    return *this;
+}
+
+FRect FRect::Extension(float amount) const
+{
+    FRect r = *this;
+    r.Extend(amount);
+    return r;
+}
+
+FRect FRect::Extension(float hamount, float vamount) const
+{
+    FRect r = *this;
+    r.Extend(hamount, vamount);
+    return r;
+}
+
+FRect& FRect::Extend(float amount)
+{
+    return Extend(amount, amount);
+}
+
+FRect& FRect::Extend(float hamount, float vamount)
+{
+    x -= hamount;
+    y -= vamount;
+    w += hamount * 2;
+    h += vamount * 2;
+    return *this;
+}
+
+std::optional<FRect> FRect::GetIntersection(const FRect& rect) const
+{
+    if (!Intersects(rect))
+        return std::nullopt;
+    return FRect::FromCorners(
+            std::max(x, rect.x),
+            std::max(y, rect.y),
+            std::min(X2(), rect.X2()),
+            std::min(Y2(), rect.Y2())
+        );
+}
+
+Rect FRect::Enclosing() const
+{
+    int x1 = static_cast<int>(std::floor(x));
+    int y1 = static_cast<int>(std::floor(y));
+    int x2 = static_cast<int>(std::ceil(X2()));
+    int y2 = static_cast<int>(std::ceil(Y2()));
+    return Rect(x1, y1, x2 - x1, y2 - y1);
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 22)
+bool FRect::IntersectsLine(float& x1, float& y1, float& x2, float& y2) const {
+    return SDL_IntersectFRectAndLine(this, &x1, &y1, &x2, &y2) == SDL_TRUE;
+}
+
+bool FRect::IntersectsLine(FPoint& p1, FPoint& p2) const {
+    return SDL_IntersectFRectAndLine(this, &p1.x, &p1.y, &p2.x, &p2.y) == SDL_TRUE;
+}
+#endif
+
+} // sdl2
+
+std::ostream& operator<<(std::ostream& stream, const sdl2::FRect& rect) {
+    stream << "[ x:" << rect.x << "; y:" << rect.y << "; w:" << rect.w << "; h:" << rect.h << " ]";
+    return stream;
+}
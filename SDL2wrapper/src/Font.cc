@@ -19,7 +19,7 @@ Font::Font(TTF_Font* font) : font_(font) {
 Font::Font(const std::string& file, int ptsize, long index) {
     font_ = FontPtr(TTF_OpenFontIndex(file.c_str(), ptsize, index));
     if (font_ == nullptr)
-        throw SDLException("TTF_OpenFontIndex");
+        ThrowSDLException("TTF_OpenFontIndex");
 }
 
 Font::Font(Font&& other) noexcept 
@@ -119,34 +119,34 @@ int Font::IsGlyphProvided(Uint16 ch) const {
 
 void Font::GlyphMetrics(Uint16 ch, int& minx, int& maxx, int& miny, int& maxy, int& advance) const {
     if (TTF_GlyphMetrics(font_.get(), ch, &minx, &maxx, &miny, &maxy, &advance) != 0)
-        throw SDLException("TTF_GlyphMetrics");
+        ThrowSDLException("TTF_GlyphMetrics");
 }
 
 Rect Font::GlyphRect(Uint16 ch) const {
     int minx, maxx, miny, maxy;
     if (TTF_GlyphMetrics(font_.get(), ch, &minx, &maxx, &miny, &maxy, nullptr) != 0)
-        throw SDLException("TTF_GlyphMetrics");
+        ThrowSDLException("TTF_GlyphMetrics");
     return Rect(minx, miny, maxx - minx, maxy - miny);
 }
 
 int Font::GlyphAdvance(Uint16 ch) const {
     int advance;
     if (TTF_GlyphMetrics(font_.get(), ch, nullptr, nullptr, nullptr, nullptr, &advance) != 0)
-        throw SDLException("TTF_GlyphMetrics");
+        ThrowSDLException("TTF_GlyphMetrics");
     return advance;
 }
 
 Point Font::SizeOfText(const std::string& text) const {
     int w, h;
     if (TTF_SizeText(font_.get(), text.c_str(), &w, &h) != 0)
-        throw SDLException("TTF_SizeText");
+        ThrowSDLException("TTF_SizeText");
     return Point(w, h);
 }
 
 Point Font::SizeOfUTF8(const std::string& text) const {
     int w, h;
     if (TTF_SizeUTF8(font_.get(), text.c_str(), &w, &h) != 0)
-        throw SDLException("TTF_SizeUTF8");
+        ThrowSDLException("TTF_SizeUTF8");
     return Point(w, h);
 }
 
@@ -159,21 +159,21 @@ Point Font::SizeOfUnicode(const std::u16string& text) const {
 Point Font::SizeOfUnicode(const Uint16* text) const {
     int w, h;
     if (TTF_SizeUNICODE(font_.get(), text, &w, &h) != 0)
-        throw SDLException("TTF_SizeUNICODE");
+        ThrowSDLException("TTF_SizeUNICODE");
     return Point(w, h);
 }
 
 Surface Font::RenderText_Solid(const std::string& text, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderText_Solid(font_.get(), text.c_str(), fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderText_Solid");
+        ThrowSDLException("TTF_RenderText_Solid");
     return Surface(surface);
 }
 
 Surface Font::RenderUTF8_Solid(const std::string& text, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderUTF8_Solid(font_.get(), text.c_str(), fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderUTF8_Solid");
+        ThrowSDLException("TTF_RenderUTF8_Solid");
     return Surface(surface);
 }
 
@@ -186,28 +186,28 @@ Surface Font::RenderUNICODE_Solid(const std::u16string& text, SDL_Color fg) {
 Surface Font::RenderUNICODE_Solid(const Uint16* text, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderUNICODE_Solid(font_.get(), text, fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderUNICODE_Solid");
+        ThrowSDLException("TTF_RenderUNICODE_Solid");
     return Surface(surface);
 }
 
 Surface Font::RenderGlyph_Solid(Uint16 ch, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderGlyph_Solid(font_.get(), ch, fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderGlyph_Solid");
+        ThrowSDLException("TTF_RenderGlyph_Solid");
     return Surface(surface);
 }
 
 Surface Font::RenderText_Shaded(const std::string& text, SDL_Color fg, SDL_Color bg) {
     SDL_Surface* surface = TTF_RenderText_Shaded(font_.get(), text.c_str(), fg, bg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderText_Shaded");
+        ThrowSDLException("TTF_RenderText_Shaded");
     return Surface(surface);
 }
 
 Surface Font::RenderUTF8_Shaded(const std::string& text, SDL_Color fg, SDL_Color bg) {
     SDL_Surface* surface = TTF_RenderUTF8_Shaded(font_.get(), text.c_str(), fg, bg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderUTF8_Shaded");
+        ThrowSDLException("TTF_RenderUTF8_Shaded");
     return Surface(surface);
 }
 
@@ -220,28 +220,28 @@ Surface Font::RenderUNICODE_Shaded(const std::u16string& text, SDL_Color fg, SDL
 Surface Font::RenderUNICODE_Shaded(const Uint16* text, SDL_Color fg, SDL_Color bg) {
     SDL_Surface* surface = TTF_RenderUNICODE_Shaded(font_.get(), text, fg, bg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderUNICODE_Shaded");
+        ThrowSDLException("TTF_RenderUNICODE_Shaded");
     return Surface(surface);
 }
 
 Surface Font::RenderGlyph_Shaded(Uint16 ch, SDL_Color fg, SDL_Color bg) {
     SDL_Surface* surface = TTF_RenderGlyph_Shaded(font_.get(), ch, fg, bg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderGlyph_Shaded");
+        ThrowSDLException("TTF_RenderGlyph_Shaded");
     return Surface(surface);
 }
 
 Surface Font::RenderText_Blended(const std::string& text, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderText_Blended(font_.get(), text.c_str(), fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderText_Blended");
+        ThrowSDLException("TTF_RenderText_Blended");
     return Surface(surface);
 }
 
 Surface Font::RenderUTF8_Blended(const std::string& text, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderUTF8_Blended(font_.get(), text.c_str(), fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderUTF8_Blended");
+        ThrowSDLException("TTF_RenderUTF8_Blended");
     return Surface(surface);
 }
 
@@ -254,14 +254,14 @@ Surface Font::RenderUNICODE_Blended(const std::u16string& text, SDL_Color fg) {
 Surface Font::RenderUNICODE_Blended(const Uint16* text, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderUNICODE_Blended(font_.get(), text, fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderUNICODE_Blended");
+        ThrowSDLException("TTF_RenderUNICODE_Blended");
     return Surface(surface);
 }
 
 Surface Font::RenderGlyph_Blended(Uint16 ch, SDL_Color fg) {
     SDL_Surface* surface = TTF_RenderGlyph_Blended(font_.get(), ch, fg);
     if (surface == nullptr)
-        throw SDLException("TTF_RenderGlyph_Blended");
+        ThrowSDLException("TTF_RenderGlyph_Blended");
     return Surface(surface);
 }
 
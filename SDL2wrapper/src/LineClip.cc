@@ -0,0 +1,287 @@
+#include "SDL2wrapper/include/LineClip.h"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "SDL2/include/SDL_stdinc.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+namespace
+{
+
+// outcodes are worked out for this many points at a time
+constexpr int kChunk = 256;
+
+// Inclusive clip bounds, as SDL_IntersectRectAndLine uses them. Outcode
+// bits here are only used to accept or reject whole segments, so their
+// layout need not match SDL's.
+struct Bounds
+{
+    int x1;
+    int y1;
+    int x2;
+    int y2;
+};
+
+constexpr Uint8 kLeft = 1;
+constexpr Uint8 kTop = 2;
+constexpr Uint8 kRight = 4;
+constexpr Uint8 kBottom = 8;
+
+#if defined(__SSE2__)
+
+// two points per register: x0 y0 x1 y1
+void Outcodes(const Bounds& b, const Point* points, int count, Uint8* codes)
+{
+    const __m128i lo = _mm_setr_epi32(b.x1, b.y1, b.x1, b.y1);
+    const __m128i hi = _mm_setr_epi32(b.x2, b.y2, b.x2, b.y2);
+    int i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(points + i));
+        const int below = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(v, lo)));
+        const int above = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, hi)));
+        codes[i] = static_cast<Uint8>((below & 3) | ((above & 3) << 2));
+        codes[i + 1] = static_cast<Uint8>((below >> 2) | ((above >> 2) << 2));
+    }
+    for (; i < count; ++i)
+    {
+        const Point& p = points[i];
+        codes[i] = static_cast<Uint8>((p.x < b.x1 ? kLeft : 0) | (p.y < b.y1 ? kTop : 0) |
+            (p.x > b.x2 ? kRight : 0) | (p.y > b.y2 ? kBottom : 0));
+    }
+}
+
+#else
+
+void Outcodes(const Bounds& b, const Point* points, int count, Uint8* codes)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        const Point& p = points[i];
+        codes[i] = static_cast<Uint8>((p.x < b.x1 ? kLeft : 0) | (p.y < b.y1 ? kTop : 0) |
+            (p.x > b.x2 ? kRight : 0) | (p.y > b.y2 ? kBottom : 0));
+    }
+}
+
+#endif
+
+// SDL's own outcodes, whose order decides which edge is clipped first
+constexpr int kCodeBottom = 1;
+constexpr int kCodeTop = 2;
+constexpr int kCodeLeft = 4;
+constexpr int kCodeRight = 8;
+
+int SDLOutcode(const Bounds& b, int x, int y)
+{
+    int code = 0;
+    if (y < b.y1)
+        code |= kCodeTop;
+    else if (y > b.y2)
+        code |= kCodeBottom;
+    if (x < b.x1)
+        code |= kCodeLeft;
+    else if (x > b.x2)
+        code |= kCodeRight;
+    return code;
+}
+
+// SDL_IntersectRectAndLine for a segment with at least one end outside
+// and not wholly beyond one edge. Products are widened so that huge
+// coordinates do not overflow; otherwise the arithmetic is SDL's.
+bool ClipSlow(const Bounds& b, Point& p1, Point& p2)
+{
+    int x1 = p1.x;
+    int y1 = p1.y;
+    int x2 = p2.x;
+    int y2 = p2.y;
+
+    if (y1 == y2)
+    {
+        p1.x = std::clamp(x1, b.x1, b.x2);
+        p2.x = std::clamp(x2, b.x1, b.x2);
+        return true;
+    }
+    if (x1 == x2)
+    {
+        p1.y = std::clamp(y1, b.y1, b.y2);
+        p2.y = std::clamp(y2, b.y1, b.y2);
+        return true;
+    }
+
+    auto along_y = [&](int y) {
+        return x1 + static_cast<int>(static_cast<Sint64>(x2 - x1) * (y - y1) / (y2 - y1));
+    };
+    auto along_x = [&](int x) {
+        return y1 + static_cast<int>(static_cast<Sint64>(y2 - y1) * (x - x1) / (x2 - x1));
+    };
+
+    int code1 = SDLOutcode(b, x1, y1);
+    int code2 = SDLOutcode(b, x2, y2);
+    while (code1 != 0 || code2 != 0)
+    {
+        if ((code1 & code2) != 0)
+            return false;
+
+        const int code = code1 != 0 ? code1 : code2;
+        int x, y;
+        if (code & kCodeTop)
+        {
+            y = b.y1;
+            x = along_y(y);
+        }
+        else if (code & kCodeBottom)
+        {
+            y = b.y2;
+            x = along_y(y);
+        }
+        else if (code & kCodeLeft)
+        {
+            x = b.x1;
+            y = along_x(x);
+        }
+        else
+        {
+            x = b.x2;
+            y = along_x(x);
+        }
+
+        if (code1 != 0)
+        {
+            x1 = x;
+            y1 = y;
+            code1 = SDLOutcode(b, x, y);
+        }
+        else
+        {
+            x2 = x;
+            y2 = y;
+            code2 = SDLOutcode(b, x, y);
+        }
+    }
+
+    p1 = Point(x1, y1);
+    p2 = Point(x2, y2);
+    return true;
+}
+
+// clips the segment (a, b) whose outcodes are ca and cb
+bool Clip(const Bounds& bounds, Uint8 ca, Uint8 cb, Point& a, Point& b)
+{
+    if ((ca | cb) == 0)
+        return true;
+    if ((ca & cb) != 0)
+        return false;
+    return ClipSlow(bounds, a, b);
+}
+
+Bounds MakeBounds(const Rect& rect)
+{
+    return Bounds{rect.x, rect.y, rect.x + rect.w - 1, rect.y + rect.h - 1};
+}
+
+} // namespace
+
+int ClipSegments(const Rect& rect, const Point* points, int count, Point* out)
+{
+    if (rect.w <= 0 || rect.h <= 0)
+        return 0;
+
+    const Bounds bounds = MakeBounds(rect);
+    Uint8 codes[kChunk];
+    int written = 0;
+    count &= ~1;
+    for (int start = 0; start < count; start += kChunk)
+    {
+        const int n = std::min(kChunk, count - start);
+        const Point* chunk = points + start;
+        Outcodes(bounds, chunk, n, codes);
+        for (int i = 0; i < n; i += 2)
+        {
+            Point a = chunk[i];
+            Point b = chunk[i + 1];
+            if (!Clip(bounds, codes[i], codes[i + 1], a, b))
+                continue;
+            out[written++] = a;
+            out[written++] = b;
+        }
+    }
+    return written;
+}
+
+void ClipSegments(const Rect& rect, const std::vector<Point>& points, std::vector<Point>& out)
+{
+    out.resize(points.size());
+    out.resize(ClipSegments(rect, points.data(), static_cast<int>(points.size()), out.data()));
+}
+
+int ClipPolyline(const Rect& rect, const Point* points, int count, Point* out, int* runs)
+{
+    if (rect.w <= 0 || rect.h <= 0 || count < 2)
+        return 0;
+
+    const Bounds bounds = MakeBounds(rect);
+    Uint8 codes[kChunk];
+    int written = 0;
+    int pieces = 0;
+    // chunks overlap by one point so every segment has both codes
+    for (int start = 0; start + 1 < count; start += kChunk - 1)
+    {
+        const int n = std::min(kChunk, count - start);
+        const Point* chunk = points + start;
+        Outcodes(bounds, chunk, n, codes);
+        for (int i = 0; i + 1 < n; ++i)
+        {
+            Point a = chunk[i];
+            Point b = chunk[i + 1];
+            if (!Clip(bounds, codes[i], codes[i + 1], a, b))
+                continue;
+
+            // pieces that meet are drawn as one polyline
+            if (pieces > 0 && a == out[written - 1])
+            {
+                out[written++] = b;
+                ++runs[pieces - 1];
+            }
+            else
+            {
+                out[written++] = a;
+                out[written++] = b;
+                runs[pieces++] = 2;
+            }
+        }
+    }
+    return pieces;
+}
+
+void ClipPolyline(const Rect& rect, const std::vector<Point>& points,
+    std::vector<Point>& out, std::vector<int>& runs)
+{
+    const int count = static_cast<int>(points.size());
+    if (count < 2)
+    {
+        out.clear();
+        runs.clear();
+        return;
+    }
+
+    out.resize(2 * (count - 1));
+    runs.resize(count - 1);
+    const int pieces = ClipPolyline(rect, points.data(), count, out.data(), runs.data());
+    runs.resize(pieces);
+    int points_written = 0;
+    for (int run : runs)
+        points_written += run;
+    out.resize(points_written);
+}
+
+} // sdl2
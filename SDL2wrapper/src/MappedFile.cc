@@ -0,0 +1,145 @@
+#include "SDL2wrapper/include/MappedFile.h"
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SDL2WRAPPER_HAS_MMAP
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "SDL2/include/SDL_error.h"
+#include "SDL2/include/SDL_rwops.h"
+
+#include "SDL2wrapper/include/Exception.h"
+
+namespace sdl2
+{
+
+MappedFile::MappedFile() :
+    data_(nullptr), size_(0), mapped_(false)
+{}
+
+MappedFile::MappedFile(const std::string& path) : MappedFile()
+{
+#ifdef SDL2WRAPPER_HAS_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        SDL_SetError("%s: %s", path.c_str(), std::strerror(errno));
+        ThrowSDLException("open");
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        SDL_SetError("%s: %s", path.c_str(), std::strerror(errno));
+        close(fd);
+        ThrowSDLException("fstat");
+    }
+
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ > 0)
+    {
+        void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+        {
+            SDL_SetError("%s: %s", path.c_str(), std::strerror(errno));
+            close(fd);
+            ThrowSDLException("mmap");
+        }
+        data_ = static_cast<const Uint8*>(p);
+        mapped_ = true;
+    }
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+#else
+    SDL_RWops* rw = SDL_RWFromFile(path.c_str(), "rb");
+    if (rw == nullptr)
+        ThrowSDLException("SDL_RWFromFile");
+
+    Sint64 size = SDL_RWsize(rw);
+    if (size < 0)
+    {
+        SDL_RWclose(rw);
+        ThrowSDLException("SDL_RWsize");
+    }
+
+    buffer_.resize(static_cast<std::size_t>(size));
+    if (size > 0 && SDL_RWread(rw, buffer_.data(), buffer_.size(), 1) != 1)
+    {
+        SDL_RWclose(rw);
+        ThrowSDLException("SDL_RWread");
+    }
+    SDL_RWclose(rw);
+
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    Release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    data_(other.data_), size_(other.size_), mapped_(other.mapped_),
+    buffer_(std::move(other.buffer_))
+{
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.mapped_ = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (&other == this)
+        return *this;
+
+    Release();
+    data_ = other.data_;
+    size_ = other.size_;
+    mapped_ = other.mapped_;
+    buffer_ = std::move(other.buffer_);
+
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.mapped_ = false;
+    return *this;
+}
+
+void MappedFile::Release()
+{
+#ifdef SDL2WRAPPER_HAS_MMAP
+    if (mapped_)
+        munmap(const_cast<Uint8*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buffer_.clear();
+}
+
+const Uint8* MappedFile::Data() const
+{
+    return data_;
+}
+
+std::size_t MappedFile::Size() const
+{
+    return size_;
+}
+
+bool MappedFile::Mapped() const
+{
+    return mapped_;
+}
+
+} // sdl2
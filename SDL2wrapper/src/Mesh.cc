@@ -0,0 +1,203 @@
+#include "SDL2wrapper/include/Mesh.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+namespace
+{
+
+constexpr int kQuadIndices[6] = {0, 1, 2, 0, 2, 3};
+
+} // namespace
+
+Mesh::Mesh() :
+    texture_(nullptr), inv_width_(0.0f), inv_height_(0.0f)
+{}
+
+Mesh::Mesh(Texture* texture) : Mesh()
+{
+    SetTexture(texture);
+}
+
+Mesh& Mesh::SetTexture(Texture* texture)
+{
+    if (texture == nullptr)
+    {
+        texture_ = nullptr;
+        inv_width_ = 0.0f;
+        inv_height_ = 0.0f;
+        return *this;
+    }
+
+    Point size = texture->Size();
+    texture_ = texture->Get();
+    inv_width_ = 1.0f / size.x;
+    inv_height_ = 1.0f / size.y;
+    return *this;
+}
+
+Mesh& Mesh::Clear()
+{
+    vertices_.clear();
+    indices_.clear();
+    return *this;
+}
+
+Mesh& Mesh::Reserve(int vertices, int indices)
+{
+    vertices_.reserve(static_cast<size_t>(vertices));
+    indices_.reserve(static_cast<size_t>(indices));
+    return *this;
+}
+
+int Mesh::AddVertices(const SDL_Vertex* vertices, int count)
+{
+    const int first = VertexCount();
+    vertices_.insert(vertices_.end(), vertices, vertices + count);
+    return first;
+}
+
+int Mesh::AddVertices(const std::vector<SDL_Vertex>& vertices)
+{
+    return AddVertices(vertices.data(), static_cast<int>(vertices.size()));
+}
+
+int Mesh::AddQuad(const Rect& srcrect, const FRect& dstrect, const Color& color)
+{
+    const int first = VertexCount();
+    vertices_.resize(vertices_.size() + 4);
+    QuadVertices(&vertices_[first], srcrect, dstrect, color);
+    // the quad needs indices; keep drawing the triangle list added before it
+    if (indices_.empty())
+    {
+        for (int i = 0; i < first; ++i)
+            indices_.push_back(i);
+    }
+    for (int index : kQuadIndices)
+        indices_.push_back(first + index);
+    return first;
+}
+
+int Mesh::AddQuad(const FRect& dstrect, const Color& color)
+{
+    return AddQuad(Rect(), dstrect, color);
+}
+
+Mesh& Mesh::AddIndices(const int* indices, int count)
+{
+    indices_.insert(indices_.end(), indices, indices + count);
+    return *this;
+}
+
+Mesh& Mesh::AddIndices(const std::vector<int>& indices)
+{
+    return AddIndices(indices.data(), static_cast<int>(indices.size()));
+}
+
+Mesh& Mesh::UpdateVertices(int first, const SDL_Vertex* vertices, int count)
+{
+    assert(first >= 0 && count >= 0 && first + count <= VertexCount());
+    std::copy(vertices, vertices + count, vertices_.begin() + first);
+    return *this;
+}
+
+Mesh& Mesh::UpdateIndices(int first, const int* indices, int count)
+{
+    assert(first >= 0 && count >= 0 && first + count <= IndexCount());
+    std::copy(indices, indices + count, indices_.begin() + first);
+    return *this;
+}
+
+Mesh& Mesh::UpdateQuad(int first, const Rect& srcrect, const FRect& dstrect, const Color& color)
+{
+    assert(first >= 0 && first + 4 <= VertexCount());
+    QuadVertices(&vertices_[first], srcrect, dstrect, color);
+    return *this;
+}
+
+Mesh& Mesh::SetColor(int first, int count, const Color& color)
+{
+    assert(first >= 0 && count >= 0 && first + count <= VertexCount());
+    for (int i = first; i < first + count; ++i)
+        vertices_[i].color = color;
+    return *this;
+}
+
+Mesh& Mesh::Translate(int first, int count, const FPoint& offset)
+{
+    assert(first >= 0 && count >= 0 && first + count <= VertexCount());
+    for (int i = first; i < first + count; ++i)
+    {
+        vertices_[i].position.x += offset.x;
+        vertices_[i].position.y += offset.y;
+    }
+    return *this;
+}
+
+void Mesh::QuadVertices(SDL_Vertex* quad, const Rect& srcrect, const FRect& dstrect, const Color& color) const
+{
+    const float u0 = srcrect.x * inv_width_;
+    const float v0 = srcrect.y * inv_height_;
+    const float u1 = (srcrect.x + srcrect.w) * inv_width_;
+    const float v1 = (srcrect.y + srcrect.h) * inv_height_;
+
+    const float x0 = dstrect.x;
+    const float y0 = dstrect.y;
+    const float x1 = dstrect.x + dstrect.w;
+    const float y1 = dstrect.y + dstrect.h;
+
+    quad[0] = {{x0, y0}, color, {u0, v0}};
+    quad[1] = {{x1, y0}, color, {u1, v0}};
+    quad[2] = {{x1, y1}, color, {u1, v1}};
+    quad[3] = {{x0, y1}, color, {u0, v1}};
+}
+
+SDL_Texture* Mesh::GetTexture() const
+{
+    return texture_;
+}
+
+bool Mesh::Empty() const
+{
+    return vertices_.empty();
+}
+
+SDL_Vertex* Mesh::Vertices()
+{
+    return vertices_.data();
+}
+
+const SDL_Vertex* Mesh::Vertices() const
+{
+    return vertices_.data();
+}
+
+int Mesh::VertexCount() const
+{
+    return static_cast<int>(vertices_.size());
+}
+
+const int* Mesh::Indices() const
+{
+    return indices_.empty() ? nullptr : indices_.data();
+}
+
+int Mesh::IndexCount() const
+{
+    return static_cast<int>(indices_.size());
+}
+
+} // sdl2
@@ -20,10 +20,8 @@ Rect Rect::Union(const Rect& rect) const
 
 Rect& Rect::MakeUnionWith(const Rect& rect)
 {
-    x = std::min(x, rect.x);
-    y = std::min(y, rect.y);
-    X2(std::max(X2(), rect.X2()));
-    Y2(std::max(Y2(), rect.Y2()));
+    // X2() and Y2() depend on x and y, so they cannot be updated in place
+    *this = Union(rect);
     return *this;
 }
 
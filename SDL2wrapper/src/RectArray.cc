@@ -0,0 +1,477 @@
+#include "SDL2wrapper/include/RectArray.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+// The SIMD kernels are compiled for their instruction set whatever the
+// build flags, and picked at run time by what the CPU supports.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define SDL2WRAPPER_RECT_X86 1
+    #include <immintrin.h>
+    #define SDL2WRAPPER_TARGET(isa) __attribute__((target(isa)))
+    #define SDL2WRAPPER_FORCE_INLINE inline __attribute__((always_inline))
+#else
+    #define SDL2WRAPPER_RECT_X86 0
+    #define SDL2WRAPPER_FORCE_INLINE inline
+#endif
+
+namespace sdl2
+{
+
+namespace
+{
+
+// lanes are padded to a multiple of this many rects
+constexpr int kBlock = 8;
+
+constexpr int kNever1 = std::numeric_limits<int>::max();
+constexpr int kNever2 = std::numeric_limits<int>::min();
+
+// Every test is x1 < a && b < x2 && y1 < c && d < y2 for some a, b, c, d.
+struct Query
+{
+    int a;
+    int b;
+    int c;
+    int d;
+};
+
+using detail::RectKernel;
+using detail::RectLanes;
+
+// Match() sets bit k when rect i + k matches
+struct ScalarBlock
+{
+    static unsigned Match(const RectLanes& l, int i, const Query& q)
+    {
+        unsigned bits = 0;
+        for (int k = 0; k < kBlock; ++k)
+        {
+            const int j = i + k;
+            const bool match = l.x1[j] < q.a && q.b < l.x2[j] && l.y1[j] < q.c && q.d < l.y2[j];
+            bits |= static_cast<unsigned>(match) << k;
+        }
+        return bits;
+    }
+};
+
+#if SDL2WRAPPER_RECT_X86
+
+struct Sse41Block
+{
+    SDL2WRAPPER_TARGET("sse4.1")
+    static unsigned Match(const RectLanes& l, int i, const Query& q)
+    {
+        const __m128i a = _mm_set1_epi32(q.a);
+        const __m128i b = _mm_set1_epi32(q.b);
+        const __m128i c = _mm_set1_epi32(q.c);
+        const __m128i d = _mm_set1_epi32(q.d);
+        unsigned bits = 0;
+        for (int half = 0; half < 2; ++half)
+        {
+            const int j = i + half * 4;
+            const __m128i lx1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.x1 + j));
+            const __m128i ly1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.y1 + j));
+            const __m128i lx2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.x2 + j));
+            const __m128i ly2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.y2 + j));
+            __m128i m = _mm_cmpgt_epi32(a, lx1);
+            m = _mm_and_si128(m, _mm_cmpgt_epi32(lx2, b));
+            m = _mm_and_si128(m, _mm_cmpgt_epi32(c, ly1));
+            m = _mm_and_si128(m, _mm_cmpgt_epi32(ly2, d));
+            bits |= static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(m))) << (half * 4);
+        }
+        return bits;
+    }
+};
+
+struct Avx2Block
+{
+    SDL2WRAPPER_TARGET("avx2")
+    static unsigned Match(const RectLanes& l, int i, const Query& q)
+    {
+        const __m256i lx1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.x1 + i));
+        const __m256i ly1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.y1 + i));
+        const __m256i lx2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.x2 + i));
+        const __m256i ly2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.y2 + i));
+        __m256i m = _mm256_cmpgt_epi32(_mm256_set1_epi32(q.a), lx1);
+        m = _mm256_and_si256(m, _mm256_cmpgt_epi32(lx2, _mm256_set1_epi32(q.b)));
+        m = _mm256_and_si256(m, _mm256_cmpgt_epi32(_mm256_set1_epi32(q.c), ly1));
+        m = _mm256_and_si256(m, _mm256_cmpgt_epi32(ly2, _mm256_set1_epi32(q.d)));
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+    }
+};
+
+#endif
+
+int LowestBit(unsigned bits)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(bits);
+#else
+    int k = 0;
+    while ((bits & (1u << k)) == 0)
+        ++k;
+    return k;
+#endif
+}
+
+// inlined into each kernel below so Block::Match is compiled and inlined
+// for the kernel's instruction set
+template <typename Block>
+SDL2WRAPPER_FORCE_INLINE void MatchMask(const RectLanes& l, int words, const Query& q, Uint64* mask)
+{
+    std::fill(mask, mask + words, 0);
+    for (int i = 0; i < l.padded; i += kBlock)
+        mask[i / 64] |= static_cast<Uint64>(Block::Match(l, i, q)) << (i % 64);
+}
+
+template <typename Block>
+SDL2WRAPPER_FORCE_INLINE int MatchIndices(const RectLanes& l, const Query& q, int* indices)
+{
+    int count = 0;
+    for (int i = 0; i < l.padded; i += kBlock)
+    {
+        unsigned bits = Block::Match(l, i, q);
+        while (bits != 0)
+        {
+            indices[count++] = i + LowestBit(bits);
+            bits &= bits - 1;
+        }
+    }
+    return count;
+}
+
+// x1, y1, x2, y2 of the union; padding holds the identity of each reduction
+void BoundsScalar(const RectLanes& l, int* out)
+{
+    out[0] = kNever1;
+    out[1] = kNever1;
+    out[2] = kNever2;
+    out[3] = kNever2;
+    for (int i = 0; i < l.padded; ++i)
+    {
+        out[0] = std::min(out[0], l.x1[i]);
+        out[1] = std::min(out[1], l.y1[i]);
+        out[2] = std::max(out[2], l.x2[i]);
+        out[3] = std::max(out[3], l.y2[i]);
+    }
+}
+
+void MaskScalar(const RectLanes& l, int words, const Query& q, Uint64* mask)
+{
+    MatchMask<ScalarBlock>(l, words, q, mask);
+}
+
+int IndicesScalar(const RectLanes& l, const Query& q, int* indices)
+{
+    return MatchIndices<ScalarBlock>(l, q, indices);
+}
+
+#if SDL2WRAPPER_RECT_X86
+
+SDL2WRAPPER_TARGET("sse4.1")
+void BoundsSse41(const RectLanes& l, int* out)
+{
+    __m128i vx1 = _mm_set1_epi32(kNever1);
+    __m128i vy1 = _mm_set1_epi32(kNever1);
+    __m128i vx2 = _mm_set1_epi32(kNever2);
+    __m128i vy2 = _mm_set1_epi32(kNever2);
+    for (int i = 0; i < l.padded; i += 4)
+    {
+        vx1 = _mm_min_epi32(vx1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.x1 + i)));
+        vy1 = _mm_min_epi32(vy1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.y1 + i)));
+        vx2 = _mm_max_epi32(vx2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.x2 + i)));
+        vy2 = _mm_max_epi32(vy2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(l.y2 + i)));
+    }
+    alignas(16) int lanes[4][4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes[0]), vx1);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes[1]), vy1);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes[2]), vx2);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes[3]), vy2);
+    out[0] = kNever1;
+    out[1] = kNever1;
+    out[2] = kNever2;
+    out[3] = kNever2;
+    for (int k = 0; k < 4; ++k)
+    {
+        out[0] = std::min(out[0], lanes[0][k]);
+        out[1] = std::min(out[1], lanes[1][k]);
+        out[2] = std::max(out[2], lanes[2][k]);
+        out[3] = std::max(out[3], lanes[3][k]);
+    }
+}
+
+SDL2WRAPPER_TARGET("sse4.1")
+void MaskSse41(const RectLanes& l, int words, const Query& q, Uint64* mask)
+{
+    MatchMask<Sse41Block>(l, words, q, mask);
+}
+
+SDL2WRAPPER_TARGET("sse4.1")
+int IndicesSse41(const RectLanes& l, const Query& q, int* indices)
+{
+    return MatchIndices<Sse41Block>(l, q, indices);
+}
+
+SDL2WRAPPER_TARGET("avx2")
+void BoundsAvx2(const RectLanes& l, int* out)
+{
+    __m256i vx1 = _mm256_set1_epi32(kNever1);
+    __m256i vy1 = _mm256_set1_epi32(kNever1);
+    __m256i vx2 = _mm256_set1_epi32(kNever2);
+    __m256i vy2 = _mm256_set1_epi32(kNever2);
+    for (int i = 0; i < l.padded; i += 8)
+    {
+        vx1 = _mm256_min_epi32(vx1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.x1 + i)));
+        vy1 = _mm256_min_epi32(vy1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.y1 + i)));
+        vx2 = _mm256_max_epi32(vx2, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.x2 + i)));
+        vy2 = _mm256_max_epi32(vy2, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l.y2 + i)));
+    }
+    alignas(32) int lanes[4][8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), vx1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), vy1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), vx2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3]), vy2);
+    out[0] = kNever1;
+    out[1] = kNever1;
+    out[2] = kNever2;
+    out[3] = kNever2;
+    for (int k = 0; k < 8; ++k)
+    {
+        out[0] = std::min(out[0], lanes[0][k]);
+        out[1] = std::min(out[1], lanes[1][k]);
+        out[2] = std::max(out[2], lanes[2][k]);
+        out[3] = std::max(out[3], lanes[3][k]);
+    }
+}
+
+SDL2WRAPPER_TARGET("avx2")
+void MaskAvx2(const RectLanes& l, int words, const Query& q, Uint64* mask)
+{
+    MatchMask<Avx2Block>(l, words, q, mask);
+}
+
+SDL2WRAPPER_TARGET("avx2")
+int IndicesAvx2(const RectLanes& l, const Query& q, int* indices)
+{
+    return MatchIndices<Avx2Block>(l, q, indices);
+}
+
+#endif
+
+struct Kernels
+{
+    void (*mask)(const RectLanes& l, int words, const Query& q, Uint64* mask);
+    int (*indices)(const RectLanes& l, const Query& q, int* indices);
+    void (*bounds)(const RectLanes& l, int* out);
+};
+
+// indexed by RectKernel
+const Kernels kKernels[] = {
+    {MaskScalar, IndicesScalar, BoundsScalar},
+#if SDL2WRAPPER_RECT_X86
+    {MaskSse41, IndicesSse41, BoundsSse41},
+    {MaskAvx2, IndicesAvx2, BoundsAvx2},
+#endif
+};
+
+RectKernel BestKernel()
+{
+    if (detail::RectKernelSupported(RectKernel::kAvx2))
+        return RectKernel::kAvx2;
+    if (detail::RectKernelSupported(RectKernel::kSse41))
+        return RectKernel::kSse41;
+    return RectKernel::kScalar;
+}
+
+RectKernel& ActiveKernel()
+{
+    static RectKernel kernel = BestKernel();
+    return kernel;
+}
+
+const Kernels& Active()
+{
+    return kKernels[static_cast<int>(ActiveKernel())];
+}
+
+Query IntersectsQuery(const Rect& rect)
+{
+    return Query{rect.x + rect.w, rect.x, rect.y + rect.h, rect.y};
+}
+
+Query ContainsQuery(const Point& point)
+{
+    return Query{point.x + 1, point.x, point.y + 1, point.y};
+}
+
+Query ContainsQuery(const Rect& rect)
+{
+    return Query{rect.x + 1, rect.x + rect.w - 1, rect.y + 1, rect.y + rect.h - 1};
+}
+
+} // namespace
+
+RectArray::RectArray() :
+    size_(0)
+{}
+
+RectArray::RectArray(const std::vector<Rect>& rects) :
+    size_(0)
+{
+    Reserve(static_cast<int>(rects.size()));
+    for (const Rect& rect : rects)
+        Add(rect);
+}
+
+detail::RectLanes RectArray::Lanes() const
+{
+    return detail::RectLanes{x1_.data(), y1_.data(), x2_.data(), y2_.data(), static_cast<int>(x1_.size())};
+}
+
+void RectArray::Pad()
+{
+    const std::size_t padded = static_cast<std::size_t>((size_ + kBlock - 1) / kBlock * kBlock);
+    x1_.resize(padded, kNever1);
+    y1_.resize(padded, kNever1);
+    x2_.resize(padded, kNever2);
+    y2_.resize(padded, kNever2);
+}
+
+RectArray& RectArray::Add(const Rect& rect)
+{
+    ++size_;
+    Pad();
+    return Set(size_ - 1, rect);
+}
+
+RectArray& RectArray::Set(int index, const Rect& rect)
+{
+    assert(index >= 0 && index < size_);
+    x1_[index] = rect.x;
+    y1_[index] = rect.y;
+    x2_[index] = rect.x + rect.w;
+    y2_[index] = rect.y + rect.h;
+    return *this;
+}
+
+RectArray& RectArray::Reserve(int count)
+{
+    const std::size_t padded = static_cast<std::size_t>((count + kBlock - 1) / kBlock * kBlock);
+    x1_.reserve(padded);
+    y1_.reserve(padded);
+    x2_.reserve(padded);
+    y2_.reserve(padded);
+    return *this;
+}
+
+RectArray& RectArray::Clear()
+{
+    size_ = 0;
+    x1_.clear();
+    y1_.clear();
+    x2_.clear();
+    y2_.clear();
+    return *this;
+}
+
+Rect RectArray::Get(int index) const
+{
+    assert(index >= 0 && index < size_);
+    return Rect(x1_[index], y1_[index], x2_[index] - x1_[index], y2_[index] - y1_[index]);
+}
+
+int RectArray::Size() const
+{
+    return size_;
+}
+
+int RectArray::MaskWords() const
+{
+    return (size_ + 63) / 64;
+}
+
+void RectArray::Intersects(const Rect& rect, Uint64* mask) const
+{
+    Active().mask(Lanes(), MaskWords(), IntersectsQuery(rect), mask);
+}
+
+int RectArray::Intersects(const Rect& rect, int* indices) const
+{
+    return Active().indices(Lanes(), IntersectsQuery(rect), indices);
+}
+
+void RectArray::Contains(const Point& point, Uint64* mask) const
+{
+    Active().mask(Lanes(), MaskWords(), ContainsQuery(point), mask);
+}
+
+int RectArray::Contains(const Point& point, int* indices) const
+{
+    return Active().indices(Lanes(), ContainsQuery(point), indices);
+}
+
+void RectArray::Contains(const Rect& rect, Uint64* mask) const
+{
+    Active().mask(Lanes(), MaskWords(), ContainsQuery(rect), mask);
+}
+
+int RectArray::Contains(const Rect& rect, int* indices) const
+{
+    return Active().indices(Lanes(), ContainsQuery(rect), indices);
+}
+
+Rect RectArray::Bounds() const
+{
+    if (size_ == 0)
+        return Rect();
+
+    int bounds[4];
+    Active().bounds(Lanes(), bounds);
+    return Rect(bounds[0], bounds[1], bounds[2] - bounds[0], bounds[3] - bounds[1]);
+}
+
+namespace detail
+{
+
+bool RectKernelSupported(RectKernel kernel)
+{
+#if SDL2WRAPPER_RECT_X86
+    __builtin_cpu_init();
+    switch (kernel)
+    {
+    case RectKernel::kSse41:
+        return __builtin_cpu_supports("sse4.1");
+    case RectKernel::kAvx2:
+        return __builtin_cpu_supports("avx2");
+    default:
+        return true;
+    }
+#else
+    return kernel == RectKernel::kScalar;
+#endif
+}
+
+bool UseRectKernel(RectKernel kernel)
+{
+    if (!RectKernelSupported(kernel))
+        return false;
+    ActiveKernel() = kernel;
+    return true;
+}
+
+RectKernel ActiveRectKernel()
+{
+    return ActiveKernel();
+}
+
+} // detail
+
+} // sdl2
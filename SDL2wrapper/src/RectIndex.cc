@@ -0,0 +1,384 @@
+#include "SDL2wrapper/include/RectIndex.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+namespace
+{
+
+int FloorDiv(int a, int b)
+{
+    return a / b - (a % b != 0 && (a < 0) != (b < 0) ? 1 : 0);
+}
+
+// writes into a fixed buffer and counts what did not fit
+class BufferOutput
+{
+public:
+    BufferOutput(int* handles, int capacity) :
+        handles_(handles), capacity_(capacity), count_(0)
+    {}
+
+    void operator()(int handle)
+    {
+        if (count_ < capacity_)
+            handles_[count_] = handle;
+        ++count_;
+    }
+
+    int Count() const
+    {
+        return count_;
+    }
+
+private:
+    int* handles_;
+    int capacity_;
+    int count_;
+};
+
+} // namespace
+
+GridIndex::GridIndex(const Rect& bounds, int cell_size) :
+    bounds_(bounds), cell_size_(std::max(cell_size, 1)), size_(0)
+{
+    columns_ = std::max(1, (bounds.w + cell_size_ - 1) / cell_size_);
+    rows_ = std::max(1, (bounds.h + cell_size_ - 1) / cell_size_);
+    cells_.resize(static_cast<std::size_t>(columns_) * rows_);
+}
+
+int GridIndex::CellX(int x) const
+{
+    return std::clamp(FloorDiv(x - bounds_.x, cell_size_), 0, columns_ - 1);
+}
+
+int GridIndex::CellY(int y) const
+{
+    return std::clamp(FloorDiv(y - bounds_.y, cell_size_), 0, rows_ - 1);
+}
+
+GridIndex::CellRange GridIndex::Cells(const Rect& rect) const
+{
+    return CellRange{CellX(rect.x), CellY(rect.y), CellX(rect.X2()), CellY(rect.Y2())};
+}
+
+void GridIndex::Link(int handle)
+{
+    CellRange range = Cells(entries_[handle].rect);
+    for (int cy = range.y1; cy <= range.y2; ++cy)
+    {
+        for (int cx = range.x1; cx <= range.x2; ++cx)
+            cells_[cy * columns_ + cx].push_back(handle);
+    }
+}
+
+void GridIndex::Unlink(int handle)
+{
+    CellRange range = Cells(entries_[handle].rect);
+    for (int cy = range.y1; cy <= range.y2; ++cy)
+    {
+        for (int cx = range.x1; cx <= range.x2; ++cx)
+        {
+            std::vector<int>& cell = cells_[cy * columns_ + cx];
+            auto it = std::find(cell.begin(), cell.end(), handle);
+            assert(it != cell.end());
+            *it = cell.back();
+            cell.pop_back();
+        }
+    }
+}
+
+int GridIndex::Insert(const Rect& rect)
+{
+    int handle;
+    if (!free_.empty())
+    {
+        handle = free_.back();
+        free_.pop_back();
+        entries_[handle] = Entry{rect, true};
+    }
+    else
+    {
+        handle = static_cast<int>(entries_.size());
+        entries_.push_back(Entry{rect, true});
+    }
+    Link(handle);
+    ++size_;
+    return handle;
+}
+
+void GridIndex::Update(int handle, const Rect& rect)
+{
+    assert(handle >= 0 && handle < static_cast<int>(entries_.size()) && entries_[handle].alive);
+    CellRange before = Cells(entries_[handle].rect);
+    CellRange after = Cells(rect);
+    // small moves usually stay within the same cells
+    if (before.x1 == after.x1 && before.y1 == after.y1 && before.x2 == after.x2 && before.y2 == after.y2)
+    {
+        entries_[handle].rect = rect;
+        return;
+    }
+    Unlink(handle);
+    entries_[handle].rect = rect;
+    Link(handle);
+}
+
+void GridIndex::Remove(int handle)
+{
+    assert(handle >= 0 && handle < static_cast<int>(entries_.size()) && entries_[handle].alive);
+    Unlink(handle);
+    entries_[handle].alive = false;
+    free_.push_back(handle);
+    --size_;
+}
+
+void GridIndex::Clear()
+{
+    for (std::vector<int>& cell : cells_)
+        cell.clear();
+    entries_.clear();
+    free_.clear();
+    size_ = 0;
+}
+
+const Rect& GridIndex::Get(int handle) const
+{
+    assert(handle >= 0 && handle < static_cast<int>(entries_.size()) && entries_[handle].alive);
+    return entries_[handle].rect;
+}
+
+int GridIndex::Size() const
+{
+    return size_;
+}
+
+template <typename Output>
+int GridIndex::Collect(const Rect& area, Output output) const
+{
+    if (area.w <= 0 || area.h <= 0)
+        return 0;
+
+    int count = 0;
+    CellRange range = Cells(area);
+    for (int cy = range.y1; cy <= range.y2; ++cy)
+    {
+        for (int cx = range.x1; cx <= range.x2; ++cx)
+        {
+            for (int handle : cells_[cy * columns_ + cx])
+            {
+                const Rect& rect = entries_[handle].rect;
+                if (!rect.Intersects(area))
+                    continue;
+                // a rect in several cells is reported only from the cell
+                // holding the top left corner of its overlap with area
+                if (CellX(std::max(rect.x, area.x)) != cx || CellY(std::max(rect.y, area.y)) != cy)
+                    continue;
+                output(handle);
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+int GridIndex::Query(const Rect& area, int* handles, int capacity) const
+{
+    return Collect(area, BufferOutput(handles, capacity));
+}
+
+int GridIndex::Query(const Point& point, int* handles, int capacity) const
+{
+    return Query(Rect(point, 1, 1), handles, capacity);
+}
+
+int GridIndex::Query(const Rect& area, std::vector<int>& handles) const
+{
+    handles.clear();
+    return Collect(area, [&handles](int handle) { handles.push_back(handle); });
+}
+
+QuadtreeIndex::QuadtreeIndex(const Rect& bounds, int max_depth) :
+    bounds_(bounds), size_(0)
+{
+    // stop before cells shrink below a pixel
+    int depth = std::max(max_depth, 0);
+    while (depth > 0 && ((bounds.w >> depth) < 1 || (bounds.h >> depth) < 1))
+        --depth;
+
+    levels_.resize(depth + 1);
+    for (int d = 0; d <= depth; ++d)
+    {
+        Level& level = levels_[d];
+        level.columns = 1 << d;
+        level.cell_w = std::max(1, (bounds.w + level.columns - 1) >> d);
+        level.cell_h = std::max(1, (bounds.h + level.columns - 1) >> d);
+        level.cells.resize(static_cast<std::size_t>(level.columns) * level.columns);
+    }
+}
+
+void QuadtreeIndex::Place(int handle)
+{
+    Entry& entry = entries_[handle];
+    const Rect& rect = entry.rect;
+    const Point center(rect.x + rect.w / 2, rect.y + rect.h / 2);
+
+    // rects centered outside the bounds go to the root, which every query
+    // searches
+    int level = 0;
+    if (bounds_.Contains(center))
+    {
+        while (level + 1 < static_cast<int>(levels_.size()) &&
+            rect.w <= levels_[level + 1].cell_w && rect.h <= levels_[level + 1].cell_h)
+            ++level;
+    }
+
+    const Level& l = levels_[level];
+    int cx = std::clamp((center.x - bounds_.x) / l.cell_w, 0, l.columns - 1);
+    int cy = std::clamp((center.y - bounds_.y) / l.cell_h, 0, l.columns - 1);
+    if (level == 0)
+        cx = cy = 0;
+
+    std::vector<int>& cell = levels_[level].cells[cy * l.columns + cx];
+    entry.level = level;
+    entry.cell = cy * l.columns + cx;
+    entry.slot = static_cast<int>(cell.size());
+    cell.push_back(handle);
+}
+
+void QuadtreeIndex::Unplace(int handle)
+{
+    Entry& entry = entries_[handle];
+    std::vector<int>& cell = levels_[entry.level].cells[entry.cell];
+    int moved = cell.back();
+    cell[entry.slot] = moved;
+    entries_[moved].slot = entry.slot;
+    cell.pop_back();
+    entry.slot = -1;
+}
+
+int QuadtreeIndex::Insert(const Rect& rect)
+{
+    int handle;
+    if (!free_.empty())
+    {
+        handle = free_.back();
+        free_.pop_back();
+    }
+    else
+    {
+        handle = static_cast<int>(entries_.size());
+        entries_.emplace_back();
+    }
+    entries_[handle] = Entry{rect, 0, 0, -1};
+    Place(handle);
+    ++size_;
+    return handle;
+}
+
+void QuadtreeIndex::Update(int handle, const Rect& rect)
+{
+    assert(handle >= 0 && handle < static_cast<int>(entries_.size()) && entries_[handle].slot >= 0);
+    Unplace(handle);
+    entries_[handle].rect = rect;
+    Place(handle);
+}
+
+void QuadtreeIndex::Remove(int handle)
+{
+    assert(handle >= 0 && handle < static_cast<int>(entries_.size()) && entries_[handle].slot >= 0);
+    Unplace(handle);
+    free_.push_back(handle);
+    --size_;
+}
+
+void QuadtreeIndex::Clear()
+{
+    for (Level& level : levels_)
+    {
+        for (std::vector<int>& cell : level.cells)
+            cell.clear();
+    }
+    entries_.clear();
+    free_.clear();
+    size_ = 0;
+}
+
+const Rect& QuadtreeIndex::Get(int handle) const
+{
+    assert(handle >= 0 && handle < static_cast<int>(entries_.size()) && entries_[handle].slot >= 0);
+    return entries_[handle].rect;
+}
+
+int QuadtreeIndex::Size() const
+{
+    return size_;
+}
+
+int QuadtreeIndex::Depth() const
+{
+    return static_cast<int>(levels_.size()) - 1;
+}
+
+template <typename Output>
+int QuadtreeIndex::Collect(const Rect& area, Output output) const
+{
+    if (area.w <= 0 || area.h <= 0)
+        return 0;
+
+    int count = 0;
+    for (std::size_t d = 0; d < levels_.size(); ++d)
+    {
+        const Level& level = levels_[d];
+        // rects reach at most half a cell past their cell; a whole cell of
+        // margin keeps the range simple
+        int x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+        if (d > 0)
+        {
+            x1 = std::max(0, FloorDiv(area.x - bounds_.x, level.cell_w) - 1);
+            y1 = std::max(0, FloorDiv(area.y - bounds_.y, level.cell_h) - 1);
+            x2 = std::min(level.columns - 1, FloorDiv(area.X2() - bounds_.x, level.cell_w) + 1);
+            y2 = std::min(level.columns - 1, FloorDiv(area.Y2() - bounds_.y, level.cell_h) + 1);
+        }
+
+        for (int cy = y1; cy <= y2; ++cy)
+        {
+            for (int cx = x1; cx <= x2; ++cx)
+            {
+                for (int handle : level.cells[cy * level.columns + cx])
+                {
+                    if (entries_[handle].rect.Intersects(area))
+                    {
+                        output(handle);
+                        ++count;
+                    }
+                }
+            }
+        }
+    }
+    return count;
+}
+
+int QuadtreeIndex::Query(const Rect& area, int* handles, int capacity) const
+{
+    return Collect(area, BufferOutput(handles, capacity));
+}
+
+int QuadtreeIndex::Query(const Point& point, int* handles, int capacity) const
+{
+    return Query(Rect(point, 1, 1), handles, capacity);
+}
+
+int QuadtreeIndex::Query(const Rect& area, std::vector<int>& handles) const
+{
+    handles.clear();
+    return Collect(area, [&handles](int handle) { handles.push_back(handle); });
+}
+
+} // sdl2
@@ -0,0 +1,149 @@
+#include "SDL2wrapper/include/RectPacker.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <optional>
+#include <vector>
+
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+RectPacker::RectPacker(int width, int height) :
+    width_(width), height_(height), used_area_(0)
+{
+    Clear();
+}
+
+void RectPacker::Clear()
+{
+    used_area_ = 0;
+    free_.clear();
+    if (width_ > 0 && height_ > 0)
+        free_.emplace_back(0, 0, width_, height_);
+}
+
+std::optional<Rect> RectPacker::Insert(int w, int h)
+{
+    if (w <= 0 || h <= 0)
+        return std::nullopt;
+
+    int best = -1;
+    int best_short = INT_MAX;
+    int best_long = INT_MAX;
+    for (std::size_t i = 0; i < free_.size(); ++i)
+    {
+        const Rect& f = free_[i];
+        if (f.w < w || f.h < h)
+            continue;
+
+        int leftover_w = f.w - w;
+        int leftover_h = f.h - h;
+        int short_side = std::min(leftover_w, leftover_h);
+        int long_side = std::max(leftover_w, leftover_h);
+        if (short_side < best_short || (short_side == best_short && long_side < best_long))
+        {
+            best = static_cast<int>(i);
+            best_short = short_side;
+            best_long = long_side;
+        }
+    }
+    if (best < 0)
+        return std::nullopt;
+
+    Rect used(free_[best].x, free_[best].y, w, h);
+
+    split_.clear();
+    for (std::size_t i = 0; i < free_.size();)
+    {
+        if (SplitFreeRect(free_[i], used))
+        {
+            free_[i] = free_.back();
+            free_.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    free_.insert(free_.end(), split_.begin(), split_.end());
+    PruneFreeRects();
+
+    used_area_ += static_cast<long long>(w) * h;
+    return used;
+}
+
+bool RectPacker::SplitFreeRect(const Rect& free, const Rect& used)
+{
+    if (!free.Intersects(used))
+        return false;
+
+    const int free_x2 = free.x + free.w;
+    const int free_y2 = free.y + free.h;
+    const int used_x2 = used.x + used.w;
+    const int used_y2 = used.y + used.h;
+
+    // the parts of free above, below, left and right of used; they overlap
+    if (used.y > free.y)
+        split_.emplace_back(free.x, free.y, free.w, used.y - free.y);
+    if (used_y2 < free_y2)
+        split_.emplace_back(free.x, used_y2, free.w, free_y2 - used_y2);
+    if (used.x > free.x)
+        split_.emplace_back(free.x, free.y, used.x - free.x, free.h);
+    if (used_x2 < free_x2)
+        split_.emplace_back(used_x2, free.y, free_x2 - used_x2, free.h);
+    return true;
+}
+
+void RectPacker::PruneFreeRects()
+{
+    // drop free rectangles contained in another one
+    for (std::size_t i = 0; i < free_.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < free_.size();)
+        {
+            if (free_[i].Contains(free_[j]))
+            {
+                free_[j] = free_.back();
+                free_.pop_back();
+            }
+            else if (free_[j].Contains(free_[i]))
+            {
+                free_[i] = free_[j];
+                free_[j] = free_.back();
+                free_.pop_back();
+                j = i + 1;
+            }
+            else
+            {
+                ++j;
+            }
+        }
+    }
+}
+
+int RectPacker::Width() const
+{
+    return width_;
+}
+
+int RectPacker::Height() const
+{
+    return height_;
+}
+
+double RectPacker::Occupancy() const
+{
+    if (width_ <= 0 || height_ <= 0)
+        return 0.0;
+    return static_cast<double>(used_area_) / (static_cast<double>(width_) * height_);
+}
+
+const std::vector<Rect>& RectPacker::FreeRects() const
+{
+    return free_;
+}
+
+} // sdl2
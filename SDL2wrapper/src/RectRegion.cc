@@ -0,0 +1,429 @@
+#include "SDL2wrapper/include/RectRegion.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+namespace sdl2
+{
+
+namespace
+{
+
+// horizontal extent [x1, x2) of a rect within a band
+struct Span
+{
+    int x1;
+    int x2;
+};
+
+bool operator==(const Span& a, const Span& b)
+{
+    return a.x1 == b.x1 && a.x2 == b.x2;
+}
+
+// rects [begin, end) of one band
+struct Band
+{
+    std::vector<Rect>::const_iterator begin;
+    std::vector<Rect>::const_iterator end;
+
+    int Top() const
+    {
+        return begin->y;
+    }
+
+    int Bottom() const
+    {
+        return begin->y + begin->h;
+    }
+};
+
+Band NextBand(std::vector<Rect>::const_iterator begin, std::vector<Rect>::const_iterator end)
+{
+    std::vector<Rect>::const_iterator it = begin;
+    while (it != end && it->y == begin->y)
+        ++it;
+    return Band{begin, it};
+}
+
+// Appends bands while merging each one into the band above when they touch
+// and have the same spans.
+class BandWriter
+{
+public:
+    explicit BandWriter(std::vector<Rect>& out) :
+        out_(out), previous_(0), current_(0)
+    {}
+
+    void Write(int y1, int y2, const std::vector<Span>& spans)
+    {
+        if (spans.empty() || y1 >= y2)
+            return;
+
+        const std::size_t previous_size = current_ - previous_;
+        if (previous_size == spans.size() && previous_size > 0 &&
+            out_[previous_].y + out_[previous_].h == y1)
+        {
+            bool same = true;
+            for (std::size_t i = 0; i < spans.size() && same; ++i)
+            {
+                const Rect& r = out_[previous_ + i];
+                same = spans[i] == Span{r.x, r.x + r.w};
+            }
+            if (same)
+            {
+                for (std::size_t i = previous_; i < current_; ++i)
+                    out_[i].h = y2 - out_[i].y;
+                return;
+            }
+        }
+
+        previous_ = out_.size();
+        for (const Span& s : spans)
+            out_.emplace_back(s.x1, y1, s.x2 - s.x1, y2 - y1);
+        current_ = out_.size();
+    }
+
+private:
+    std::vector<Rect>& out_;
+    std::size_t previous_;
+    std::size_t current_;
+};
+
+void AppendSpans(const Band* band, int y, std::vector<Span>& spans)
+{
+    spans.clear();
+    if (band == nullptr || y < band->Top() || y >= band->Bottom())
+        return;
+    for (auto it = band->begin; it != band->end; ++it)
+        spans.push_back(Span{it->x, it->x + it->w});
+}
+
+// Combines two sorted span lists with a sweep over their edges. Adjacent
+// output spans are joined.
+template <typename Keep>
+void CombineSpans(const std::vector<Span>& a, const std::vector<Span>& b, Keep keep, std::vector<Span>& out)
+{
+    out.clear();
+    std::size_t i = 0;
+    std::size_t j = 0;
+    bool in_a = false;
+    bool in_b = false;
+    int start = 0;
+    bool inside = false;
+
+    while (i < a.size() * 2 || j < b.size() * 2)
+    {
+        // edges alternate start, end within each list
+        const int xa = i < a.size() * 2 ? (i % 2 == 0 ? a[i / 2].x1 : a[i / 2].x2) : 0;
+        const int xb = j < b.size() * 2 ? (j % 2 == 0 ? b[j / 2].x1 : b[j / 2].x2) : 0;
+        int x;
+        if (j >= b.size() * 2 || (i < a.size() * 2 && xa <= xb))
+            x = xa;
+        else
+            x = xb;
+        // apply every edge at x before testing, so touching spans join
+        while (i < a.size() * 2 && (i % 2 == 0 ? a[i / 2].x1 : a[i / 2].x2) == x)
+        {
+            in_a = i % 2 == 0;
+            ++i;
+        }
+        while (j < b.size() * 2 && (j % 2 == 0 ? b[j / 2].x1 : b[j / 2].x2) == x)
+        {
+            in_b = j % 2 == 0;
+            ++j;
+        }
+
+        const bool now = keep(in_a, in_b);
+        if (now && !inside)
+            start = x;
+        else if (!now && inside)
+            out.push_back(Span{start, x});
+        inside = now;
+    }
+}
+
+} // namespace
+
+RectRegion::RectRegion()
+{}
+
+RectRegion::RectRegion(const Rect& rect)
+{
+    if (rect.w > 0 && rect.h > 0)
+    {
+        rects_.push_back(rect);
+        bounds_ = rect;
+    }
+}
+
+RectRegion::RectRegion(const Rect* rects, int count) :
+    RectRegion(UnionOf(rects, count))
+{}
+
+RectRegion::RectRegion(const std::vector<Rect>& rects) :
+    RectRegion(rects.data(), static_cast<int>(rects.size()))
+{}
+
+RectRegion RectRegion::UnionOf(const Rect* rects, int count)
+{
+    // pairwise merges, so every rect takes part in O(log n) unions
+    if (count <= 0)
+        return RectRegion();
+    if (count == 1)
+        return RectRegion(rects[0]);
+    const int half = count / 2;
+    return Combine(UnionOf(rects, half), UnionOf(rects + half, count - half), Op::Union);
+}
+
+RectRegion RectRegion::Combine(const RectRegion& a, const RectRegion& b, Op op)
+{
+    auto keep = [op](bool in_a, bool in_b) {
+        switch (op)
+        {
+        case Op::Union:
+            return in_a || in_b;
+        case Op::Intersection:
+            return in_a && in_b;
+        case Op::Difference:
+            return in_a && !in_b;
+        }
+        return false;
+    };
+
+    RectRegion result;
+    if (op == Op::Intersection && (a.Empty() || b.Empty() || !a.bounds_.Intersects(b.bounds_)))
+        return result;
+    if (op == Op::Difference && (a.Empty() || b.Empty() || !a.bounds_.Intersects(b.bounds_)))
+        return a;
+    if (op == Op::Union && b.Empty())
+        return a;
+    if (op == Op::Union && a.Empty())
+        return b;
+
+    result.rects_.reserve(a.rects_.size() + b.rects_.size());
+    BandWriter writer(result.rects_);
+    std::vector<Span> spans_a;
+    std::vector<Span> spans_b;
+    std::vector<Span> spans;
+
+    // both regions are non-empty here
+    Band band_a = NextBand(a.rects_.cbegin(), a.rects_.cend());
+    Band band_b = NextBand(b.rects_.cbegin(), b.rects_.cend());
+    bool has_a = true;
+    bool has_b = true;
+
+    int y = std::min(band_a.Top(), band_b.Top());
+    while (has_a || has_b)
+    {
+        // nothing more can come out once the needed operand runs out
+        if ((op == Op::Intersection && !(has_a && has_b)) || (op == Op::Difference && !has_a))
+            break;
+
+        // the slice [y, next) lies within at most one band of each region
+        int next = std::numeric_limits<int>::max();
+        if (has_a)
+            next = std::min(next, y < band_a.Top() ? band_a.Top() : band_a.Bottom());
+        if (has_b)
+            next = std::min(next, y < band_b.Top() ? band_b.Top() : band_b.Bottom());
+
+        AppendSpans(has_a ? &band_a : nullptr, y, spans_a);
+        AppendSpans(has_b ? &band_b : nullptr, y, spans_b);
+        CombineSpans(spans_a, spans_b, keep, spans);
+        writer.Write(y, next, spans);
+
+        y = next;
+        if (has_a && y >= band_a.Bottom())
+        {
+            has_a = band_a.end != a.rects_.cend();
+            if (has_a)
+                band_a = NextBand(band_a.end, a.rects_.cend());
+        }
+        if (has_b && y >= band_b.Bottom())
+        {
+            has_b = band_b.end != b.rects_.cend();
+            if (has_b)
+                band_b = NextBand(band_b.end, b.rects_.cend());
+        }
+        // skip a gap that neither region covers
+        if (has_a && has_b)
+            y = std::max(y, std::min(band_a.Top(), band_b.Top()));
+        else if (has_a)
+            y = std::max(y, band_a.Top());
+        else if (has_b)
+            y = std::max(y, band_b.Top());
+    }
+
+    if (!result.rects_.empty())
+    {
+        result.bounds_ = result.rects_.front();
+        for (const Rect& r : result.rects_)
+            result.bounds_.MakeUnionWith(r);
+    }
+    return result;
+}
+
+RectRegion RectRegion::Union(const RectRegion& region) const
+{
+    return Combine(*this, region, Op::Union);
+}
+
+RectRegion RectRegion::Intersection(const RectRegion& region) const
+{
+    return Combine(*this, region, Op::Intersection);
+}
+
+RectRegion RectRegion::Difference(const RectRegion& region) const
+{
+    return Combine(*this, region, Op::Difference);
+}
+
+RectRegion& RectRegion::MakeUnionWith(const RectRegion& region)
+{
+    *this = Union(region);
+    return *this;
+}
+
+RectRegion& RectRegion::Intersect(const RectRegion& region)
+{
+    *this = Intersection(region);
+    return *this;
+}
+
+RectRegion& RectRegion::Subtract(const RectRegion& region)
+{
+    *this = Difference(region);
+    return *this;
+}
+
+RectRegion& RectRegion::Translate(const Point& offset)
+{
+    for (Rect& r : rects_)
+        r += offset;
+    if (!rects_.empty())
+        bounds_ += offset;
+    return *this;
+}
+
+RectRegion& RectRegion::Clear()
+{
+    rects_.clear();
+    bounds_ = Rect();
+    return *this;
+}
+
+bool RectRegion::Empty() const
+{
+    return rects_.empty();
+}
+
+RectRegion::const_iterator RectRegion::FindBand(int y) const
+{
+    return std::partition_point(rects_.begin(), rects_.end(),
+        [y](const Rect& r) { return r.y + r.h <= y; });
+}
+
+bool RectRegion::Contains(const Point& point) const
+{
+    if (rects_.empty() || !bounds_.Contains(point))
+        return false;
+
+    const_iterator band = FindBand(point.y);
+    if (band == rects_.end() || band->y > point.y)
+        return false;
+    const_iterator band_end = NextBand(band, rects_.end()).end;
+    const_iterator it = std::partition_point(band, band_end,
+        [&point](const Rect& r) { return r.x + r.w <= point.x; });
+    return it != band_end && it->x <= point.x;
+}
+
+bool RectRegion::Contains(const Rect& rect) const
+{
+    if (rect.w <= 0 || rect.h <= 0)
+        return true;
+    if (rects_.empty() || !bounds_.Contains(rect))
+        return false;
+
+    // every band across rect must be contiguous and hold one span covering it
+    int y = rect.y;
+    for (const_iterator band = FindBand(y); y < rect.y + rect.h; )
+    {
+        if (band == rects_.end() || band->y > y)
+            return false;
+        const_iterator band_end = NextBand(band, rects_.end()).end;
+        const_iterator it = std::partition_point(band, band_end,
+            [&rect](const Rect& r) { return r.x + r.w <= rect.x; });
+        if (it == band_end || it->x > rect.x || it->x + it->w < rect.x + rect.w)
+            return false;
+        y = band->y + band->h;
+        band = band_end;
+    }
+    return true;
+}
+
+bool RectRegion::Intersects(const Rect& rect) const
+{
+    if (rect.w <= 0 || rect.h <= 0 || rects_.empty() || !bounds_.Intersects(rect))
+        return false;
+
+    for (const_iterator band = FindBand(rect.y); band != rects_.end() && band->y < rect.y + rect.h; )
+    {
+        const_iterator band_end = NextBand(band, rects_.end()).end;
+        const_iterator it = std::partition_point(band, band_end,
+            [&rect](const Rect& r) { return r.x + r.w <= rect.x; });
+        if (it != band_end && it->x < rect.x + rect.w)
+            return true;
+        band = band_end;
+    }
+    return false;
+}
+
+Rect RectRegion::Bounds() const
+{
+    return bounds_;
+}
+
+long long RectRegion::Area() const
+{
+    long long area = 0;
+    for (const Rect& r : rects_)
+        area += static_cast<long long>(r.w) * r.h;
+    return area;
+}
+
+int RectRegion::Size() const
+{
+    return static_cast<int>(rects_.size());
+}
+
+const std::vector<Rect>& RectRegion::Rects() const
+{
+    return rects_;
+}
+
+RectRegion::const_iterator RectRegion::begin() const
+{
+    return rects_.begin();
+}
+
+RectRegion::const_iterator RectRegion::end() const
+{
+    return rects_.end();
+}
+
+bool RectRegion::operator==(const RectRegion& region) const
+{
+    return rects_ == region.rects_;
+}
+
+bool RectRegion::operator!=(const RectRegion& region) const
+{
+    return !(*this == region);
+}
+
+} // sdl2
@@ -0,0 +1,202 @@
+#include "SDL2wrapper/include/RenderTargetPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <utility>
+
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+RenderTargetPool::Lease::Lease(Entry* entry) :
+    entry_(entry)
+{
+    entry_->leased = true;
+}
+
+RenderTargetPool::Lease::Lease() :
+    entry_(nullptr)
+{}
+
+RenderTargetPool::Lease::~Lease()
+{
+    Release();
+}
+
+RenderTargetPool::Lease::Lease(Lease&& other) noexcept :
+    entry_(other.entry_)
+{
+    other.entry_ = nullptr;
+}
+
+RenderTargetPool::Lease& RenderTargetPool::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        entry_ = other.entry_;
+        other.entry_ = nullptr;
+    }
+    return *this;
+}
+
+Texture& RenderTargetPool::Lease::Get() const
+{
+    assert(entry_ != nullptr);
+    return entry_->texture;
+}
+
+Texture& RenderTargetPool::Lease::operator*() const
+{
+    return Get();
+}
+
+Texture* RenderTargetPool::Lease::operator->() const
+{
+    return &Get();
+}
+
+RenderTargetPool::Lease::operator bool() const
+{
+    return entry_ != nullptr;
+}
+
+void RenderTargetPool::Lease::Release()
+{
+    if (entry_ != nullptr)
+    {
+        entry_->leased = false;
+        entry_ = nullptr;
+    }
+}
+
+RenderTargetPool::RenderTargetPool(Renderer& renderer, int max_idle_frames) :
+    renderer_(&renderer), max_idle_frames_(std::max(max_idle_frames, 0)),
+    frame_(0), hits_(0), misses_(0), evictions_(0)
+{}
+
+RenderTargetPool::~RenderTargetPool()
+{
+    assert(Leased() == 0);
+}
+
+RenderTargetPool::Lease RenderTargetPool::Acquire(int w, int h, Uint32 format)
+{
+    Bucket& bucket = buckets_[Key(w, h, format)];
+    for (std::unique_ptr<Entry>& entry : bucket)
+    {
+        if (!entry->leased)
+        {
+            ++hits_;
+            entry->last_used = frame_;
+            return Lease(entry.get());
+        }
+    }
+
+    ++misses_;
+    bucket.push_back(std::make_unique<Entry>(Entry{
+        CreateTexture(*renderer_, format, SDL_TEXTUREACCESS_TARGET, w, h), false, frame_}));
+    return Lease(bucket.back().get());
+}
+
+RenderTargetPool& RenderTargetPool::EndFrame()
+{
+    // targets still leased at the end of a frame count as used in it
+    for (auto& [key, bucket] : buckets_)
+    {
+        for (std::unique_ptr<Entry>& entry : bucket)
+        {
+            if (entry->leased)
+                entry->last_used = frame_;
+        }
+    }
+    ++frame_;
+    Evict(false);
+    return *this;
+}
+
+RenderTargetPool& RenderTargetPool::Trim()
+{
+    Evict(true);
+    return *this;
+}
+
+void RenderTargetPool::Evict(bool all)
+{
+    for (auto it = buckets_.begin(); it != buckets_.end();)
+    {
+        Bucket& bucket = it->second;
+        auto idle = [this, all](const std::unique_ptr<Entry>& entry) {
+            return !entry->leased &&
+                (all || frame_ - entry->last_used > static_cast<Uint64>(max_idle_frames_));
+        };
+        auto end = std::remove_if(bucket.begin(), bucket.end(), idle);
+        evictions_ += static_cast<Uint64>(bucket.end() - end);
+        bucket.erase(end, bucket.end());
+
+        if (bucket.empty())
+            it = buckets_.erase(it);
+        else
+            ++it;
+    }
+}
+
+int RenderTargetPool::Size() const
+{
+    int size = 0;
+    for (const auto& [key, bucket] : buckets_)
+        size += static_cast<int>(bucket.size());
+    return size;
+}
+
+int RenderTargetPool::Leased() const
+{
+    int leased = 0;
+    for (const auto& [key, bucket] : buckets_)
+    {
+        for (const std::unique_ptr<Entry>& entry : bucket)
+            leased += entry->leased ? 1 : 0;
+    }
+    return leased;
+}
+
+int RenderTargetPool::MaxIdleFrames() const
+{
+    return max_idle_frames_;
+}
+
+RenderTargetPool& RenderTargetPool::MaxIdleFrames(int frames)
+{
+    max_idle_frames_ = std::max(frames, 0);
+    return *this;
+}
+
+Uint64 RenderTargetPool::Hits() const
+{
+    return hits_;
+}
+
+Uint64 RenderTargetPool::Misses() const
+{
+    return misses_;
+}
+
+Uint64 RenderTargetPool::Evictions() const
+{
+    return evictions_;
+}
+
+RenderTargetPool& RenderTargetPool::ResetCounters()
+{
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+    return *this;
+}
+
+} // sdl2
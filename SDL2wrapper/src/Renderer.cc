@@ -2,7 +2,10 @@
 
 #include <optional>
 #include <vector>
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstring>
 #include <utility>
 
 #include "SDL2/include/SDL_stdinc.h"
@@ -13,10 +16,18 @@
 #endif
 
 #include "SDL2wrapper/include/Pointers.h"
+#include "SDL2wrapper/include/DrawBuffer.h"
 #include "SDL2wrapper/include/Point.h"
 #include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/DamageRegion.h"
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Mesh.h"
 #include "SDL2wrapper/include/Exception.h"
 #include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RendererStats.h"
+#include "SDL2wrapper/include/SpriteBatch.h"
+#include "SDL2wrapper/include/Status.h"
 #include "SDL2wrapper/include/Window.h"
 #include "SDL2wrapper/include/Surface.h"
 #include "SDL2wrapper/include/Texture.h"
@@ -24,9 +35,138 @@
 namespace sdl2
 {
 
+namespace
+{
+
+// SDL_UpdateWindowSurfaceRects gets at most this many rects, the rest are
+// folded into the last one
+constexpr int kMaxPresentRects = 16;
+
+// Conservative bounds of draw calls in drawing coordinates, used to skip
+// calls that miss the damaged region in dirty-rectangle mode. Corners are
+// inclusive, so lines and points keep the pixel at their far end.
+Rect FloatBounds(float x1, float y1, float x2, float y2)
+{
+    return Rect::FromCorners(
+        static_cast<int>(std::floor(x1)), static_cast<int>(std::floor(y1)),
+        static_cast<int>(std::ceil(x2)), static_cast<int>(std::ceil(y2))
+    );
+}
+
+Rect PointBounds(const SDL_Point* points, int count)
+{
+    if (count <= 0)
+        return Rect();
+
+    Point lo(points[0]);
+    Point hi(points[0]);
+    for (const SDL_Point* p = points + 1; p < points + count; ++p)
+    {
+        lo = Point(std::min(lo.x, p->x), std::min(lo.y, p->y));
+        hi = Point(std::max(hi.x, p->x), std::max(hi.y, p->y));
+    }
+    return Rect::FromCorners(lo, hi);
+}
+
+Rect PointBounds(const SDL_FPoint* points, int count)
+{
+    if (count <= 0)
+        return Rect();
+
+    SDL_FPoint lo = points[0];
+    SDL_FPoint hi = points[0];
+    for (const SDL_FPoint* p = points + 1; p < points + count; ++p)
+    {
+        lo = SDL_FPoint{std::min(lo.x, p->x), std::min(lo.y, p->y)};
+        hi = SDL_FPoint{std::max(hi.x, p->x), std::max(hi.y, p->y)};
+    }
+    return FloatBounds(lo.x, lo.y, hi.x, hi.y);
+}
+
+Rect LineBounds(const FPoint& start, const FPoint& end)
+{
+    return FloatBounds(
+        std::min(start.x, end.x), std::min(start.y, end.y),
+        std::max(start.x, end.x), std::max(start.y, end.y)
+    );
+}
+
+Rect VertexBounds(const SDL_Vertex* vertices, int count)
+{
+    if (count <= 0)
+        return Rect();
+
+    SDL_FPoint lo = vertices[0].position;
+    SDL_FPoint hi = vertices[0].position;
+    for (const SDL_Vertex* v = vertices + 1; v < vertices + count; ++v)
+    {
+        lo = SDL_FPoint{std::min(lo.x, v->position.x), std::min(lo.y, v->position.y)};
+        hi = SDL_FPoint{std::max(hi.x, v->position.x), std::max(hi.y, v->position.y)};
+    }
+    return FloatBounds(lo.x, lo.y, hi.x, hi.y);
+}
+
+Rect RectBounds(const Rect* rects, int count)
+{
+    if (count <= 0)
+        return Rect();
+
+    Rect bounds = rects[0];
+    for (const Rect* r = rects + 1; r < rects + count; ++r)
+        bounds.MakeUnionWith(*r);
+    return bounds;
+}
+
+Rect RectBounds(const FRect* rects, int count)
+{
+    if (count <= 0)
+        return Rect();
+
+    Rect bounds = rects[0].Enclosing();
+    for (const FRect* r = rects + 1; r < rects + count; ++r)
+        bounds.MakeUnionWith(r->Enclosing());
+    return bounds;
+}
+
+// bounding box of dst rotated by angle degrees around center, which is
+// relative to dst and defaults to its middle
+Rect CopyBounds(const FRect& dst, double angle, const SDL_FPoint* center)
+{
+    if (angle == 0.0)
+        return dst.Enclosing();
+
+    const float cx = center == nullptr ? dst.w / 2 : center->x;
+    const float cy = center == nullptr ? dst.h / 2 : center->y;
+    const double radians = angle * 3.14159265358979323846 / 180.0;
+    const float c = static_cast<float>(std::cos(radians));
+    const float s = static_cast<float>(std::sin(radians));
+
+    const SDL_FPoint corners[4] = {{0, 0}, {dst.w, 0}, {0, dst.h}, {dst.w, dst.h}};
+    SDL_FPoint rotated[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        const float dx = corners[i].x - cx;
+        const float dy = corners[i].y - cy;
+        rotated[i] = SDL_FPoint{dst.x + cx + dx * c - dy * s, dst.y + cy + dx * s + dy * c};
+    }
+    return PointBounds(rotated, 4);
+}
+
+Rect CopyBounds(const FRect& dst, double angle, const SDL_Point* center)
+{
+    if (center == nullptr)
+        return CopyBounds(dst, angle, static_cast<const SDL_FPoint*>(nullptr));
+
+    const SDL_FPoint fcenter{static_cast<float>(center->x), static_cast<float>(center->y)};
+    return CopyBounds(dst, angle, &fcenter);
+}
+
+} // namespace
+
 Renderer::Renderer(SDL_Renderer* renderer) : renderer_(renderer)
 {
     assert(renderer);
+    Resync();
 }
 
 Renderer::Renderer(Window& window, int index, Uint32 flags)
@@ -34,12 +174,25 @@ Renderer::Renderer(Window& window, int index, Uint32 flags)
     renderer_ = RendererPtr(SDL_CreateRenderer(window.Get(), index, flags));
     if (renderer_ == nullptr)
     {
-        throw SDLException("SDL_CreateRenderer");
+        ThrowSDLException("SDL_CreateRenderer");
     }
+    Resync();
 }
 
 Renderer::Renderer(Renderer&& other) noexcept
-    : renderer_(std::move(other.renderer_))
+    : renderer_(std::move(other.renderer_)),
+    draw_buffer_(std::move(other.draw_buffer_)),
+    batch_(std::move(other.batch_)),
+    deferred_(other.deferred_),
+    layer_(other.layer_),
+    cull_(other.cull_),
+    state_(other.state_),
+    stats_(other.stats_),
+    dirty_rects_(other.dirty_rects_),
+    damage_pass_(false),
+    damage_clipped_(other.damage_clipped_),
+    damage_clip_(other.damage_clip_),
+    damage_(std::move(other.damage_))
 {}
 
 Renderer& Renderer::operator=(Renderer&& other) noexcept
@@ -49,6 +202,18 @@ Renderer& Renderer::operator=(Renderer&& other) noexcept
     if (renderer_ != nullptr)
         SDL_DestroyRenderer(renderer_.get());
     renderer_ = std::move(other.renderer_);
+    draw_buffer_ = std::move(other.draw_buffer_);
+    batch_ = std::move(other.batch_);
+    deferred_ = other.deferred_;
+    layer_ = other.layer_;
+    cull_ = other.cull_;
+    state_ = other.state_;
+    stats_ = other.stats_;
+    dirty_rects_ = other.dirty_rects_;
+    damage_pass_ = false;
+    damage_clipped_ = other.damage_clipped_;
+    damage_clip_ = other.damage_clip_;
+    damage_ = std::move(other.damage_);
     return *this;
 }
 
@@ -59,37 +224,396 @@ SDL_Renderer* Renderer::Get() const
 
 Renderer& Renderer::Present()
 {
-    SDL_RenderPresent(renderer_.get());
+    ThrowIfFailed(FlushDeferred());
+    if (dirty_rects_)
+    {
+        ThrowIfFailed(RestoreClip());
+        SDL2WRAPPER_STATS_TIME(stats_, present_seconds);
+        Status status = PresentDamage();
+        damage_.Clear();
+        ThrowIfFailed(status);
+    }
+    else
+    {
+        SDL2WRAPPER_STATS_TIME(stats_, present_seconds);
+        SDL_RenderPresent(renderer_.get());
+    }
+    stats_.EndFrame();
+    ThrowIfFailed(CheckView());
     return *this;
 }
 
 Renderer& Renderer::Clear()
 {
-    if (0 != SDL_RenderClear(renderer_.get()))
+    ThrowIfFailed(TryClear());
+    return *this;
+}
+
+Renderer& Renderer::Resync()
+{
+    SDL_Renderer* renderer = renderer_.get();
+
+    // SDL's clip rect must hold the caller's before it is read back
+    ThrowIfFailed(RestoreClip());
+
+    if (0 != SDL_GetRenderDrawColor(renderer,
+        &state_.draw_color.r, &state_.draw_color.g, &state_.draw_color.b, &state_.draw_color.a
+    ))
+    {
+        ThrowSDLException("SDL_GetRenderDrawColor");
+    }
+    if (0 != SDL_GetRenderDrawBlendMode(renderer, &state_.draw_blend))
     {
-        throw SDLException("SDL_RenderClear");
+        ThrowSDLException("SDL_GetRenderDrawBlendMode");
     }
+    state_.target = SDL_GetRenderTarget(renderer);
+
+    ResyncView();
+    if (dirty_rects_ && OnDefaultTarget())
+        damage_.Add(ViewportBounds());
     return *this;
 }
 
+// SDL changes the view behind our back when the output is resized, and
+// drops the target when the target texture is destroyed
+Status Renderer::CheckView() noexcept
+{
+    SDL_Renderer* renderer = renderer_.get();
+    Point output_size;
+    if (0 != SDL_GetRendererOutputSize(renderer, &output_size.x, &output_size.y))
+        return Status("SDL_GetRendererOutputSize");
+    SDL_Texture* target = SDL_GetRenderTarget(renderer);
+    if (output_size == state_.output_size && target == state_.target)
+        return Status();
+
+    Status status = RestoreClip();
+    if (!status)
+        return status;
+    state_.target = target;
+    ResyncView();
+    if (dirty_rects_ && target == nullptr)
+        damage_.Add(ViewportBounds());
+    return Status();
+}
+
+bool Renderer::OnDefaultTarget() const
+{
+    return SDL_GetRenderTarget(renderer_.get()) == nullptr;
+}
+
+void Renderer::ResyncView()
+{
+    SDL_Renderer* renderer = renderer_.get();
+
+    SDL_Rect rect;
+    SDL_RenderGetViewport(renderer, &rect);
+    state_.viewport = rect;
+
+    if (SDL_RenderIsClipEnabled(renderer))
+    {
+        SDL_RenderGetClipRect(renderer, &rect);
+        state_.clip_rect = Rect(rect);
+    }
+    else
+    {
+        state_.clip_rect = std::nullopt;
+    }
+
+    SDL_RenderGetScale(renderer, &state_.scale_x, &state_.scale_y);
+    SDL_RenderGetLogicalSize(renderer, &state_.logical_size.x, &state_.logical_size.y);
+    SDL_GetRendererOutputSize(renderer, &state_.output_size.x, &state_.output_size.y);
+}
+
+const RendererStats& Renderer::Stats() const
+{
+    return stats_.Current();
+}
+
+const RendererStats& Renderer::FrameStats() const
+{
+    return stats_.Frame();
+}
+
 void Renderer::GetInfo(SDL_RendererInfo& info)
 {
     if (0 != SDL_GetRendererInfo(renderer_.get(), &info))
     {
-        throw SDLException("SDL_RendererInfo");
+        ThrowSDLException("SDL_RendererInfo");
+    }
+}
+
+Renderer& Renderer::Deferred(bool enabled)
+{
+    if (!enabled)
+        ThrowIfFailed(FlushDeferred());
+    deferred_ = enabled;
+    return *this;
+}
+
+bool Renderer::Deferred() const
+{
+    return deferred_;
+}
+
+Renderer& Renderer::Layer(int layer)
+{
+    layer_ = layer;
+    return *this;
+}
+
+int Renderer::Layer() const
+{
+    return layer_;
+}
+
+Renderer& Renderer::Flush()
+{
+    ThrowIfFailed(FlushDeferred());
+    ThrowIfFailed(CheckView());
+    return *this;
+}
+
+Status Renderer::FlushDeferred() noexcept
+{
+    if (draw_buffer_.Empty())
+        return Status();
+    return draw_buffer_.Flush(renderer_.get(), stats_);
+}
+
+Renderer& Renderer::Cull(bool enabled)
+{
+    cull_ = enabled;
+    return *this;
+}
+
+bool Renderer::Cull() const
+{
+    return cull_;
+}
+
+bool Renderer::CullActive() const
+{
+    return cull_ && !damage_pass_;
+}
+
+// Empty bounds are passed on, SDL decides what those draw
+bool Renderer::Culled(const Rect& bounds) noexcept
+{
+    if (bounds.w <= 0 || bounds.h <= 0)
+    {
+        ++stats_.Current().submitted;
+        return false;
+    }
+
+    std::optional<Rect> visible = ViewportBounds();
+    const std::optional<Rect> clip = ClipRect();
+    if (clip != std::nullopt)
+        visible = visible->GetIntersection(*clip);
+
+    if (visible == std::nullopt || !visible->Intersects(bounds))
+    {
+        ++stats_.Current().culled;
+        return true;
+    }
+    ++stats_.Current().submitted;
+    return false;
+}
+
+Renderer& Renderer::DirtyRects(bool enabled)
+{
+    if (enabled == dirty_rects_)
+        return *this;
+
+    ThrowIfFailed(FlushDeferred());
+    ThrowIfFailed(RestoreClip());
+    dirty_rects_ = enabled;
+    damage_.Clear();
+    // nothing on screen can be trusted yet
+    if (enabled)
+        damage_.Add(ViewportBounds());
+    return *this;
+}
+
+bool Renderer::DirtyRects() const
+{
+    return dirty_rects_;
+}
+
+Renderer& Renderer::Invalidate(const std::optional<Rect>& rect)
+{
+    if (dirty_rects_)
+        damage_.Add(rect == std::nullopt ? ViewportBounds() : *rect);
+    return *this;
+}
+
+const DamageRegion& Renderer::Damage() const
+{
+    return damage_;
+}
+
+bool Renderer::DamageActive() const
+{
+    return dirty_rects_ && !damage_pass_ && OnDefaultTarget();
+}
+
+// Replays draw once per damaged rect it touches, clipped to that rect.
+// Damaged rects are disjoint, so no pixel is drawn twice.
+template <typename DrawCall>
+Status Renderer::DrawDamaged(const Rect& bounds, DrawCall draw) noexcept
+{
+    const std::optional<Rect> user_clip = ClipRect();
+    Status status;
+    damage_pass_ = true;
+    for (const Rect& damage : damage_.Rects())
+    {
+        std::optional<Rect> clip = damage;
+        if (user_clip != std::nullopt)
+            clip = clip->GetIntersection(*user_clip);
+        if (clip == std::nullopt || !clip->Intersects(bounds))
+            continue;
+
+        status = ClipToDamage(&*clip);
+        if (!status)
+            break;
+        status = draw();
+        if (!status)
+            break;
+    }
+    damage_pass_ = false;
+    return status;
+}
+
+Status Renderer::ClipToDamage(const SDL_Rect* clip) noexcept
+{
+    const std::optional<Rect> wanted = clip == nullptr ? std::nullopt : std::optional<Rect>(*clip);
+    if (damage_clipped_ && damage_clip_ == wanted)
+        return Status();
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
+    if (0 != SDL_RenderSetClipRect(renderer_.get(), clip))
+        return Status("SDL_RenderSetClipRect");
+    damage_clipped_ = true;
+    damage_clip_ = wanted;
+    return Status();
+}
+
+Status Renderer::RestoreClip() noexcept
+{
+    if (!damage_clipped_)
+        return Status();
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
+    if (0 != SDL_RenderSetClipRect(renderer_.get(),
+        state_.clip_rect == std::nullopt ? nullptr : &*state_.clip_rect
+    ))
+        return Status("SDL_RenderSetClipRect");
+    damage_clipped_ = false;
+    return Status();
+}
+
+// SDL_RenderClear ignores the clip rect, so the damage is filled instead
+Status Renderer::ClearDamage() noexcept
+{
+    if (damage_.Empty())
+        return FlushDeferred();
+
+    // like SDL_RenderClear: no clipping and no blending
+    Status status = ClipToDamage(nullptr);
+    if (!status)
+        return status;
+
+    SDL_Renderer* renderer = renderer_.get();
+    if (state_.draw_blend != SDL_BLENDMODE_NONE &&
+        0 != SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE))
+        return Status("SDL_SetRenderDrawBlendMode");
+
+    {
+        SDL2WRAPPER_STATS_ADD(stats_, clears, 1);
+        SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+        const std::vector<Rect>& rects = damage_.Rects();
+        if (0 != SDL_RenderFillRects(renderer, rects.data(), static_cast<int>(rects.size())))
+            status = Status("SDL_RenderFillRects");
+    }
+
+    if (state_.draw_blend != SDL_BLENDMODE_NONE &&
+        0 != SDL_SetRenderDrawBlendMode(renderer, state_.draw_blend) && status)
+        status = Status("SDL_SetRenderDrawBlendMode");
+    return status;
+}
+
+// A software renderer on a window draws into the window surface, so only
+// the damaged part of it needs to reach the screen.
+Status Renderer::PresentDamage() noexcept
+{
+    SDL_Renderer* renderer = renderer_.get();
+    SDL_Window* window = SDL_RenderGetWindow(renderer);
+    SDL_RendererInfo info;
+    if (window == nullptr || 0 != SDL_GetRendererInfo(renderer, &info) ||
+        std::strcmp(info.name, "software") != 0)
+    {
+        SDL_RenderPresent(renderer);
+        return Status();
     }
+
+    if (0 != SDL_RenderFlush(renderer))
+        return Status("SDL_RenderFlush");
+    if (damage_.Empty())
+        return Status();
+
+    int output_w, output_h;
+    if (0 != SDL_GetRendererOutputSize(renderer, &output_w, &output_h))
+        return Status("SDL_GetRendererOutputSize");
+    const Rect output(0, 0, output_w, output_h);
+
+    // drawing coordinates to window pixels, rounded outwards
+    Rect pixels[kMaxPresentRects];
+    int count = 0;
+    for (const Rect& r : damage_.Rects())
+    {
+        Rect p = FloatBounds(
+            (state_.viewport.x + r.x) * state_.scale_x,
+            (state_.viewport.y + r.y) * state_.scale_y,
+            (state_.viewport.x + r.x + r.w) * state_.scale_x - 1,
+            (state_.viewport.y + r.y + r.h) * state_.scale_y - 1
+        );
+        std::optional<Rect> visible = p.GetIntersection(output);
+        if (visible == std::nullopt)
+            continue;
+        if (count == kMaxPresentRects)
+        {
+            pixels[count - 1].MakeUnionWith(*visible);
+            continue;
+        }
+        pixels[count++] = *visible;
+    }
+
+    if (count > 0 && 0 != SDL_UpdateWindowSurfaceRects(window, pixels, count))
+        return Status("SDL_UpdateWindowSurfaceRects");
+    return Status();
+}
+
+Rect Renderer::ViewportBounds() const
+{
+    Rect viewport = Viewport();
+    return Rect(0, 0, viewport.w, viewport.h);
 }
 
 Renderer& Renderer::Copy(Texture& texture, const std::optional<Rect>& srcrect, const std::optional<Rect>& dstrect)
 {
-    int result = SDL_RenderCopy(renderer_.get(), texture.Get(), 
+    ThrowIfFailed(TryCopy(texture,
         srcrect == std::nullopt ? nullptr : &*srcrect,
         dstrect == std::nullopt ? nullptr : &*dstrect
-    );
-    if (result != 0)
-    {
-        throw SDLException("SDL_RenderCopy");
-    }
+    ));
     return *this;
 }
 
@@ -104,17 +628,13 @@ Renderer& Renderer::Copy(Texture& texture, const std::optional<Rect>& srcrect, c
 }
 Renderer& Renderer::Copy(Texture& texture, const std::optional<Rect>& srcrect, const std::optional<Rect>& dstrect, double angle, const std::optional<Point>& center, int flip)
 {
-    int result = SDL_RenderCopyEx(renderer_.get(), texture.Get(),
+    ThrowIfFailed(TryCopy(texture,
         srcrect == std::nullopt ? nullptr : &*srcrect,
         dstrect == std::nullopt ? nullptr : &*dstrect,
         angle,
-        center == std::nullopt ? nullptr : &*center, 
-        static_cast<SDL_RendererFlip>(flip)
-    );
-    if (result != 0)
-    {
-        throw SDLException("SDL_RenderCopyEx");
-    }
+        center == std::nullopt ? nullptr : &*center,
+        flip
+    ));
     return *this;
 }
 
@@ -128,10 +648,70 @@ Renderer& Renderer::Copy(Texture& texture, const std::optional<Rect>& srcrect, c
     return Copy(texture, srcrect, dstrect, angle, center, flip);
 }
 
+Renderer& Renderer::Copy(Texture& texture, const std::optional<Rect>& srcrect, const FRect& dstrect)
+{
+    ThrowIfFailed(TryCopy(texture,
+        srcrect == std::nullopt ? nullptr : &*srcrect,
+        dstrect
+    ));
+    return *this;
+}
+
+Renderer& Renderer::Copy(Texture& texture, const std::optional<Rect>& srcrect, const FPoint& dstpoint)
+{
+    Point size = srcrect == std::nullopt ? texture.Size() : Point(srcrect->w, srcrect->h);
+    return Copy(texture, srcrect, FRect(dstpoint, FPoint(size)));
+}
+
+Renderer& Renderer::Copy(Texture& texture, const std::optional<Rect>& srcrect, const FRect& dstrect, double angle, const std::optional<FPoint>& center, int flip)
+{
+    ThrowIfFailed(TryCopy(texture,
+        srcrect == std::nullopt ? nullptr : &*srcrect,
+        dstrect,
+        angle,
+        center == std::nullopt ? nullptr : &*center,
+        flip
+    ));
+    return *this;
+}
+
+Renderer& Renderer::CopyBatch(Texture& texture, const CopyCommand* commands, int count)
+{
+    // keep Copy semantics: the texture modulation goes into the vertices
+    batch_.Reset(texture).Add(commands, count, texture.ColorAndAlphaMod());
+    return Draw(batch_);
+}
+
+Renderer& Renderer::Draw(const SpriteBatch& batch)
+{
+    ThrowIfFailed(TryDraw(batch));
+    return *this;
+}
+
+Renderer& Renderer::Draw(const Mesh& mesh)
+{
+    ThrowIfFailed(TryDraw(mesh));
+    return *this;
+}
+
+Renderer& Renderer::Geometry(Texture* texture, const SDL_Vertex* vertices, int num_vertices, const int* indices, int num_indices)
+{
+    ThrowIfFailed(TryGeometry(texture, vertices, num_vertices, indices, num_indices));
+    return *this;
+}
+
+Renderer& Renderer::Geometry(Texture* texture, const std::vector<SDL_Vertex>& vertices, const std::vector<int>& indices)
+{
+    return Geometry(texture,
+        vertices.data(), static_cast<int>(vertices.size()),
+        indices.empty() ? nullptr : indices.data(), static_cast<int>(indices.size())
+    );
+}
+
 Renderer& Renderer::FillCopy(Texture& texture, const std::optional<Rect>& srcrect, const std::optional<Rect>& dstrect, const Point& offset, int flip)
 {
-    Rect src = srcrect == std::nullopt ? Rect(0, 0, texture.Width(), texture.Height()) : *srcrect;
-    Rect dst = dstrect == std::nullopt ? Rect(0, 0, OutputWidth(), OutputHeight()) : *dstrect;
+    Rect src = srcrect == std::nullopt ? Rect(Point(0, 0), texture.Size()) : *srcrect;
+    Rect dst = dstrect == std::nullopt ? Rect(Point(0, 0), OutputSize()) : *dstrect;
 
     Rect start_tile(
         offset.x,
@@ -150,6 +730,10 @@ Renderer& Renderer::FillCopy(Texture& texture, const std::optional<Rect>& srcrec
     if (start_tile.y > 0)
         start_tile.y -= (start_tile.y + start_tile.h - 1) / start_tile.h * start_tile.h;
 
+    // every tile goes into one batch, submitted with a single geometry call
+    batch_.Reset(texture);
+    Color mod = texture.ColorAndAlphaMod();
+
     for (int y = start_tile.y; y < dst.h; y += start_tile.h) 
     {
         for (int x = start_tile.x; x < dst.w; x += start_tile.w) 
@@ -197,63 +781,46 @@ Renderer& Renderer::FillCopy(Texture& texture, const std::optional<Rect>& srcrec
 
                 if (flip & SDL_FLIP_VERTICAL)
                     tile_src.y = src.h - tile_src.y - tile_src.h;
-
-                Copy(texture, tile_src, tile_dst, 0.0, std::nullopt, flip);
-            } else {
-                Copy(texture, tile_src, tile_dst);
             }
+
+            batch_.Add(tile_src, tile_dst, mod, flip);
         }
     }
-    return *this;
+    return Draw(batch_);
 }
 
 Renderer& Renderer::SetDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-    if (0 != SDL_SetRenderDrawColor(renderer_.get(), r, g, b, a))
-    {
-        throw SDLException("SDL_SetRenderDrawColor");
-    }
-    return *this;
+    return SetDrawColor(Color(r, g, b, a));
 }
 
 Renderer& Renderer::SetDrawColor(const Color& color)
 {
-    return SetDrawColor(color.r, color.g, color.b, color.a);
+    ThrowIfFailed(TrySetDrawColor(color));
+    return *this;
 }
 
 Renderer& Renderer::Target()
 {
-    if (SDL_SetRenderTarget(renderer_.get(), nullptr) != 0)
-    {
-        throw SDLException("SDL_SetRenderTarget");
-    }
+    ThrowIfFailed(TryTarget(nullptr));
     return *this;
 }
 
 Renderer& Renderer::Target(Texture& texture)
 {
-    if (SDL_SetRenderTarget(renderer_.get(), texture.Get()) != 0)
-    {
-        throw SDLException("SDL_SetRenderTarget");
-    }
+    ThrowIfFailed(TryTarget(&texture));
     return *this;
 }
 
 Renderer& Renderer::DrawBlendMode(SDL_BlendMode blend)
 {
-    if (0 != SDL_SetRenderDrawBlendMode(renderer_.get(), blend))
-    {
-        throw SDLException("SDL_SetRenderDrawBlendMode");
-    }
+    ThrowIfFailed(TryDrawBlendMode(blend));
     return *this;
 }
 
 Renderer& Renderer::DrawPoint(int x, int y)
 {
-    if (0 != SDL_RenderDrawPoint(renderer_.get(), x, y))
-    {
-        throw SDLException("SDL_RenderDrawPoint");
-    }
+    ThrowIfFailed(TryDrawPoint(x, y));
     return *this;
 }
 
@@ -264,24 +831,35 @@ Renderer& Renderer::DrawPoint(const Point& p)
 
 Renderer& Renderer::DrawPoints(const Point* points, int count)
 {
-    std::vector<SDL_Point> sdl_points;
-    sdl_points.reserve(static_cast<size_t>(count));
-    for (const Point* p = points; p != points + count; p++)
-        sdl_points.emplace_back(*p);
-    
-    if (0 != SDL_RenderDrawPoints(renderer_.get(), sdl_points.data(), count))
-    {
-        throw SDLException("SDL_RenderDrawPoints");
-    }
+    ThrowIfFailed(TryDrawPoints(points, count));
     return *this;
 }
 
+Renderer& Renderer::DrawPoints(const std::vector<Point>& points)
+{
+    return DrawPoints(points.data(), static_cast<int>(points.size()));
+}
+
+Renderer& Renderer::DrawPoint(const FPoint& p)
+{
+    ThrowIfFailed(TryDrawPoint(p));
+    return *this;
+}
+
+Renderer& Renderer::DrawPoints(const FPoint* points, int count)
+{
+    ThrowIfFailed(TryDrawPoints(points, count));
+    return *this;
+}
+
+Renderer& Renderer::DrawPoints(const std::vector<FPoint>& points)
+{
+    return DrawPoints(points.data(), static_cast<int>(points.size()));
+}
+
 Renderer& Renderer::DrawLine(int x1, int y1, int x2, int y2)
 {
-    if (0 != SDL_RenderDrawLine(renderer_.get(), x1, y1, x2, y2))
-    {
-        throw SDLException("SDL_RenderDrawLine");
-    }
+    ThrowIfFailed(TryDrawLine(x1, y1, x2, y2));
     return *this;
 }
 
@@ -292,28 +870,37 @@ Renderer& Renderer::DrawLine(const Point& start, const Point& end)
 
 Renderer& Renderer::DrawLines(const Point* points, int count)
 {
-    std::vector<SDL_Point> sdl_points;
-    sdl_points.reserve(static_cast<size_t>(count));
-    for (const Point* p = points; p != points + count; p++)
-        sdl_points.emplace_back(*p);
-    
-    if (0 != SDL_RenderDrawLines(renderer_.get(), sdl_points.data(), count))
-    {
-        throw SDLException("SDL_RenderDrawLines");
-    }
+    ThrowIfFailed(TryDrawLines(points, count));
     return *this;
 }
 
-Renderer& Renderer::DrawRect(int x1, int y1, int x2, int y2)
+Renderer& Renderer::DrawLines(const std::vector<Point>& points)
 {
-    SDL_Rect rect = {x1, y1, x2 - x1+1, y2 - y1+1};
-    if (0 != SDL_RenderDrawRect(renderer_.get(), &rect))
-    {
-        throw SDLException("SDL_RenderDrawRect");
-    }
+    return DrawLines(points.data(), static_cast<int>(points.size()));
+}
+
+Renderer& Renderer::DrawLine(const FPoint& start, const FPoint& end)
+{
+    ThrowIfFailed(TryDrawLine(start, end));
+    return *this;
+}
+
+Renderer& Renderer::DrawLines(const FPoint* points, int count)
+{
+    ThrowIfFailed(TryDrawLines(points, count));
     return *this;
 }
 
+Renderer& Renderer::DrawLines(const std::vector<FPoint>& points)
+{
+    return DrawLines(points.data(), static_cast<int>(points.size()));
+}
+
+Renderer& Renderer::DrawRect(int x1, int y1, int x2, int y2)
+{
+    return DrawRect(Rect(x1, y1, x2 - x1+1, y2 - y1+1));
+}
+
 Renderer& Renderer::DrawRect(const Point& start, const Point& end)
 {
     return DrawRect(start.x, start.y, end.x, end.y);
@@ -321,36 +908,42 @@ Renderer& Renderer::DrawRect(const Point& start, const Point& end)
 
 Renderer& Renderer::DrawRect(const Rect& r)
 {
-    if (0 != SDL_RenderDrawRect(renderer_.get(), &r))
-    {
-        throw SDLException("SDL_RenderDrawRect");
-    }
+    ThrowIfFailed(TryDrawRect(r));
     return *this;
 }
 
 Renderer& Renderer::DrawRects(const Rect* rects, int count)
 {
-    std::vector<SDL_Rect> sdl_rects;
-    sdl_rects.reserve(static_cast<size_t>(count));
-    for (const Rect* r = rects; r != rects + count; r++)
-        sdl_rects.emplace_back(*r);
+    ThrowIfFailed(TryDrawRects(rects, count));
+    return *this;
+}
 
-    if (0 != SDL_RenderDrawRects(renderer_.get(), sdl_rects.data(), count))
-    {
-        throw SDLException("SDL_RenderDrawRects");
-    }
+Renderer& Renderer::DrawRects(const std::vector<Rect>& rects)
+{
+    return DrawRects(rects.data(), static_cast<int>(rects.size()));
+}
+
+Renderer& Renderer::DrawRect(const FRect& r)
+{
+    ThrowIfFailed(TryDrawRect(r));
     return *this;
 }
 
+Renderer& Renderer::DrawRects(const FRect* rects, int count)
+{
+    ThrowIfFailed(TryDrawRects(rects, count));
+    return *this;
+}
+
+Renderer& Renderer::DrawRects(const std::vector<FRect>& rects)
+{
+    return DrawRects(rects.data(), static_cast<int>(rects.size()));
+}
+
 
 Renderer& Renderer::FillRect(int x1, int y1, int x2, int y2)
 {
-    SDL_Rect rect = {x1, y1, x2 - x1+1, y2 - y1+1};
-    if (0 != SDL_RenderFillRect(renderer_.get(), &rect))
-    {
-        throw SDLException("SDL_RenderDrawRect");
-    }
-    return *this;
+    return FillRect(Rect::FromCorners(x1, y1, x2, y2));
 }
 
 Renderer& Renderer::FillRect(const Point& start, const Point& end)
@@ -360,75 +953,123 @@ Renderer& Renderer::FillRect(const Point& start, const Point& end)
 
 Renderer& Renderer::FillRect(const Rect& r)
 {
-    if (0 != SDL_RenderFillRect(renderer_.get(), &r))
-    {
-        throw SDLException("SDL_RenderDrawRect");
-    }
+    ThrowIfFailed(TryFillRect(r));
     return *this;
 }
 
 Renderer& Renderer::FillRects(const Rect* rects, int count)
 {
-    std::vector<SDL_Rect> sdl_rects;
-    sdl_rects.reserve(static_cast<size_t>(count));
-    for (const Rect* r = rects; r != rects + count; r++)
-        sdl_rects.emplace_back(*r);
+    ThrowIfFailed(TryFillRects(rects, count));
+    return *this;
+}
 
-    if (0 != SDL_RenderFillRects(renderer_.get(), sdl_rects.data(), count))
-    {
-        throw SDLException("SDL_RenderDrawRects");
-    }
+Renderer& Renderer::FillRects(const std::vector<Rect>& rects)
+{
+    return FillRects(rects.data(), static_cast<int>(rects.size()));
+}
+
+Renderer& Renderer::FillRect(const FRect& r)
+{
+    ThrowIfFailed(TryFillRect(r));
     return *this;
 }
 
+Renderer& Renderer::FillRects(const FRect* rects, int count)
+{
+    ThrowIfFailed(TryFillRects(rects, count));
+    return *this;
+}
+
+Renderer& Renderer::FillRects(const std::vector<FRect>& rects)
+{
+    return FillRects(rects.data(), static_cast<int>(rects.size()));
+}
+
 void Renderer::ReadPixels(const std::optional<Rect>& rect, Uint32 format, void* pixels, int pitch)
 {
-    if (0 != SDL_RenderReadPixels(renderer_.get(),
+    ThrowIfFailed(TryReadPixels(
         rect == std::nullopt ? nullptr : &*rect,
         format, pixels, pitch
-    ))
-    {
-        throw SDLException("SDL_RenderReadPixels");
-    }
+    ));
 }
 
 Renderer& Renderer::ClipRect(const std::optional<Rect>& rect)
 {
+    if (rect == state_.clip_rect)
+        return *this;
+
+    ThrowIfFailed(FlushDeferred());
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
     if (0 != SDL_RenderSetClipRect(renderer_.get(), 
         rect == std::nullopt ? nullptr : &* rect
     ))
     {
-        throw SDLException("SDL_RenderSetClipRect");
+        ThrowSDLException("SDL_RenderSetClipRect");
     }
+    state_.clip_rect = rect;
+    damage_clipped_ = false;
     return *this;
 }
 
 Renderer& Renderer::LogicalSize(int w, int h)
 {
+    if (state_.logical_size == Point(w, h))
+        return *this;
+
+    ThrowIfFailed(FlushDeferred());
+    ThrowIfFailed(RestoreClip());
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
     if (0 != SDL_RenderSetLogicalSize(renderer_.get(), w, h))
     {
-        throw SDLException("SDL_RenderSetLogicalSize");
+        ThrowSDLException("SDL_RenderSetLogicalSize");
     }
+    // the logical size drives both the viewport and the scale
+    ResyncView();
+    if (dirty_rects_ && OnDefaultTarget())
+        damage_.Add(ViewportBounds());
     return *this;
 }
 
 Renderer& Renderer::Scale(float scaleX, float scaleY)
 {
+    if (scaleX == state_.scale_x && scaleY == state_.scale_y)
+        return *this;
+
+    ThrowIfFailed(FlushDeferred());
+    ThrowIfFailed(RestoreClip());
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
     if (0 != SDL_RenderSetScale(renderer_.get(), scaleX, scaleY))
     {
-        throw SDLException("SDL_RenderSetScale");
+        ThrowSDLException("SDL_RenderSetScale");
     }
+    // viewport and clip rect are reported in scaled coordinates
+    ResyncView();
+    if (dirty_rects_ && OnDefaultTarget())
+        damage_.Add(ViewportBounds());
     return *this;
 }
 
 Renderer& Renderer::Viewport(const std::optional<Rect>& rect)
 {
+    if (rect != std::nullopt && *rect == state_.viewport)
+        return *this;
+
+    ThrowIfFailed(FlushDeferred());
+    ThrowIfFailed(RestoreClip());
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
     if (0 != SDL_RenderSetViewport(renderer_.get(), 
         rect == std::nullopt ? nullptr : &*rect
     ))
     {
-        throw SDLException("SDL_RenderSetViewport");
+        ThrowSDLException("SDL_RenderSetViewport");
     }
+    ResyncView();
+    if (dirty_rects_ && OnDefaultTarget())
+        damage_.Add(ViewportBounds());
     return *this;
 }
 
@@ -439,85 +1080,66 @@ bool Renderer::TargetSupported() const
 
 std::optional<Rect> Renderer::ClipRect() const
 {
-    SDL_Rect rect;
-    SDL_RenderGetClipRect(renderer_.get(), &rect);
-
-    if (SDL_RectEmpty(&rect))
+    if (state_.clip_rect == std::nullopt || SDL_RectEmpty(&*state_.clip_rect))
         return std::nullopt;
-    
-    return Rect(rect);
+
+    return state_.clip_rect;
 }
 
 Point Renderer::LogicalSize() const
 {
-    int w, h;
-    SDL_RenderGetLogicalSize(renderer_.get(), &w, &h);
-    return Point(w, h);
+    return state_.logical_size;
 }
 
 int Renderer::LogicalWidth() const
 {
-    int w;
-    SDL_RenderGetLogicalSize(renderer_.get(), &w, nullptr);
-    return w;
+    return state_.logical_size.x;
 }
 
 int Renderer::LogicalHeight() const
 {
-    int h;
-    SDL_RenderGetLogicalSize(renderer_.get(), nullptr, &h);
-    return h;
+    return state_.logical_size.y;
 }
 
 void Renderer::Scale(float* scaleX, float* scaleY)
 {
-    SDL_RenderGetScale(renderer_.get(), scaleX, scaleY);
+    if (scaleX != nullptr)
+        *scaleX = state_.scale_x;
+    if (scaleY != nullptr)
+        *scaleY = state_.scale_y;
 }
 
 float Renderer::XScale() const
 {
-    float scalex;
-    SDL_RenderGetScale(renderer_.get(), &scalex, nullptr);
-    return scalex;
+    return state_.scale_x;
 }
 
 float Renderer::YScale() const
 {
-    float scaley;
-    SDL_RenderGetScale(renderer_.get(), &scaley, nullptr);
-    return scaley;
+    return state_.scale_y;
 }
 
 Rect Renderer::Viewport() const
 {
-    SDL_Rect rect;
-    SDL_RenderGetViewport(renderer_.get(), &rect);
-    return Rect(rect);
+    return state_.viewport;
 }
 
 SDL_BlendMode Renderer::BlendMode() const
 {
-    SDL_BlendMode blend;
-    if (0 != SDL_GetRenderDrawBlendMode(renderer_.get(), &blend))
-    {
-        throw SDLException("SDL_GetRenderDrawBlendMode");
-    }
-    return blend;
+    return state_.draw_blend;
 }
 
 Color Renderer::GetDrawColor()
 {
-    Color color;
-    GetDrawColor(color.r, color.g, color.b, color.a);
-    return color;
+    return state_.draw_color;
 }
 
 void Renderer::GetDrawColor(Uint8& r, Uint8& g, Uint8& b, Uint8& a)
 {
-    if (0 != SDL_GetRenderDrawColor(renderer_.get(), &r, &g, &b, &a))
-    {
-        throw SDLException("SDL_GetRenderDrawColor");
-    }
+    r = state_.draw_color.r;
+    g = state_.draw_color.g;
+    b = state_.draw_color.b;
+    a = state_.draw_color.a;
 }
 
 Point Renderer::OutputSize() const
@@ -525,7 +1147,7 @@ Point Renderer::OutputSize() const
     int w, h;
     if (0 != SDL_GetRendererOutputSize(renderer_.get(), &w, &h))
     {
-        throw SDLException("SDL_GetRendererOutputSize");
+        ThrowSDLException("SDL_GetRendererOutputSize");
     }
     return Point(w, h);
 }
@@ -535,7 +1157,7 @@ int Renderer::OutputWidth() const
     int w;
     if (0 != SDL_GetRendererOutputSize(renderer_.get(), &w, nullptr))
     {
-        throw SDLException("SDL_GetRendererOutputSize");
+        ThrowSDLException("SDL_GetRendererOutputSize");
     }
     return w;
 }
@@ -545,17 +1167,535 @@ int Renderer::OutputHeight() const
     int h;
     if (0 != SDL_GetRendererOutputSize(renderer_.get(), nullptr, &h))
     {
-        throw SDLException("SDL_GetRendererOutputSize");
+        ThrowSDLException("SDL_GetRendererOutputSize");
     }
     return h;
 }
 
+Status Renderer::TryFlush() noexcept
+{
+    return FlushDeferred();
+}
+
+Status Renderer::TryClear() noexcept
+{
+    // a frame usually starts with Clear(), so a resize is noticed here
+    Status status = CheckView();
+    if (!status)
+        return status;
+    if (DamageActive())
+        return ClearDamage();
+
+    status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, clears, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderClear(renderer_.get()))
+        return Status("SDL_RenderClear");
+    return Status();
+}
+
+Status Renderer::TryCopy(Texture& texture, const SDL_Rect* srcrect, const SDL_Rect* dstrect) noexcept
+{
+    if (CullActive() && dstrect != nullptr && Culled(Rect(*dstrect)))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(dstrect == nullptr ? ViewportBounds() : Rect(*dstrect), [&] { return TryCopy(texture, srcrect, dstrect); });
+
+    if (deferred_)
+    {
+        return draw_buffer_.AddCopy(texture.Get(), srcrect,
+            FRect(dstrect == nullptr ? ViewportBounds() : Rect(*dstrect)),
+            0.0, nullptr, 0, layer_
+        );
+    }
+
+    SDL2WRAPPER_STATS_ADD(stats_, copies, 1);
+    SDL2WRAPPER_STATS_TEXTURE(stats_, texture.Get());
+    SDL2WRAPPER_STATS_TIME(stats_, copy_seconds);
+    if (0 != SDL_RenderCopy(renderer_.get(), texture.Get(), srcrect, dstrect))
+        return Status("SDL_RenderCopy");
+    return Status();
+}
+
+Status Renderer::TryCopy(Texture& texture, const SDL_Rect* srcrect, const SDL_Rect* dstrect,
+    double angle, const SDL_Point* center, int flip) noexcept
+{
+    if (CullActive() && dstrect != nullptr && Culled(CopyBounds(FRect(Rect(*dstrect)), angle, center)))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(CopyBounds(FRect(dstrect == nullptr ? ViewportBounds() : Rect(*dstrect)),
+            angle, center), [&] { return TryCopy(texture, srcrect, dstrect, angle, center, flip); });
+
+    if (deferred_)
+    {
+        FPoint fcenter = center == nullptr ? FPoint() : FPoint(Point(*center));
+        return draw_buffer_.AddCopy(texture.Get(), srcrect,
+            FRect(dstrect == nullptr ? ViewportBounds() : Rect(*dstrect)),
+            angle, center == nullptr ? nullptr : &fcenter, flip, layer_
+        );
+    }
+
+    SDL2WRAPPER_STATS_ADD(stats_, copies, 1);
+    SDL2WRAPPER_STATS_TEXTURE(stats_, texture.Get());
+    SDL2WRAPPER_STATS_TIME(stats_, copy_seconds);
+    if (0 != SDL_RenderCopyEx(renderer_.get(), texture.Get(), srcrect, dstrect,
+        angle, center, static_cast<SDL_RendererFlip>(flip)
+    ))
+        return Status("SDL_RenderCopyEx");
+    return Status();
+}
+
+Status Renderer::TryCopy(Texture& texture, const SDL_Rect* srcrect, const FRect& dstrect) noexcept
+{
+    if (CullActive() && Culled(dstrect.Enclosing()))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(dstrect.Enclosing(), [&] { return TryCopy(texture, srcrect, dstrect); });
+
+    if (deferred_)
+        return draw_buffer_.AddCopy(texture.Get(), srcrect, dstrect, 0.0, nullptr, 0, layer_);
+
+    SDL2WRAPPER_STATS_ADD(stats_, copies, 1);
+    SDL2WRAPPER_STATS_TEXTURE(stats_, texture.Get());
+    SDL2WRAPPER_STATS_TIME(stats_, copy_seconds);
+    if (0 != SDL_RenderCopyF(renderer_.get(), texture.Get(), srcrect, &dstrect))
+        return Status("SDL_RenderCopyF");
+    return Status();
+}
+
+Status Renderer::TryCopy(Texture& texture, const SDL_Rect* srcrect, const FRect& dstrect,
+    double angle, const SDL_FPoint* center, int flip) noexcept
+{
+    if (CullActive() && Culled(CopyBounds(dstrect, angle, center)))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(CopyBounds(dstrect, angle, center), [&] { return TryCopy(texture, srcrect, dstrect, angle, center, flip); });
+
+    if (deferred_)
+        return draw_buffer_.AddCopy(texture.Get(), srcrect, dstrect, angle, center, flip, layer_);
+
+    SDL2WRAPPER_STATS_ADD(stats_, copies, 1);
+    SDL2WRAPPER_STATS_TEXTURE(stats_, texture.Get());
+    SDL2WRAPPER_STATS_TIME(stats_, copy_seconds);
+    if (0 != SDL_RenderCopyExF(renderer_.get(), texture.Get(), srcrect, &dstrect,
+        angle, center, static_cast<SDL_RendererFlip>(flip)
+    ))
+        return Status("SDL_RenderCopyExF");
+    return Status();
+}
+
+Status Renderer::TryDraw(const SpriteBatch& batch) noexcept
+{
+    if (batch.Empty())
+        return FlushDeferred();
+
+    return SubmitGeometry(batch.GetTexture(),
+        batch.Vertices(), batch.VertexCount(),
+        batch.Indices(), batch.IndexCount()
+    );
+}
+
+Status Renderer::TryDraw(const Mesh& mesh) noexcept
+{
+    if (mesh.Empty())
+        return FlushDeferred();
+
+    return SubmitGeometry(mesh.GetTexture(),
+        mesh.Vertices(), mesh.VertexCount(),
+        mesh.Indices(), mesh.IndexCount()
+    );
+}
+
+Status Renderer::TryGeometry(Texture* texture,
+    const SDL_Vertex* vertices, int num_vertices,
+    const int* indices, int num_indices) noexcept
+{
+    return SubmitGeometry(texture == nullptr ? nullptr : texture->Get(),
+        vertices, num_vertices, indices, num_indices
+    );
+}
+
+Status Renderer::SubmitGeometry(SDL_Texture* texture,
+    const SDL_Vertex* vertices, int num_vertices,
+    const int* indices, int num_indices) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(VertexBounds(vertices, num_vertices), [&] { return SubmitGeometry(texture, vertices, num_vertices, indices, num_indices); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, geometry, 1);
+    SDL2WRAPPER_STATS_ADD(stats_, vertices, num_vertices);
+    SDL2WRAPPER_STATS_TEXTURE(stats_, texture);
+    SDL2WRAPPER_STATS_TIME(stats_, geometry_seconds);
+    if (0 != SDL_RenderGeometry(renderer_.get(), texture,
+        vertices, num_vertices, indices, num_indices
+    ))
+        return Status("SDL_RenderGeometry");
+    return Status();
+}
+
+Status Renderer::TrySetDrawColor(const Color& color) noexcept
+{
+    if (color == state_.draw_color)
+        return Status();
+
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
+    if (0 != SDL_SetRenderDrawColor(renderer_.get(), color.r, color.g, color.b, color.a))
+        return Status("SDL_SetRenderDrawColor");
+    state_.draw_color = color;
+    return Status();
+}
+
+Status Renderer::TryDrawBlendMode(SDL_BlendMode blend) noexcept
+{
+    if (blend == state_.draw_blend)
+        return Status();
+
+    SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
+    if (0 != SDL_SetRenderDrawBlendMode(renderer_.get(), blend))
+        return Status("SDL_SetRenderDrawBlendMode");
+    state_.draw_blend = blend;
+    return Status();
+}
+
+Status Renderer::TryTarget(Texture* texture) noexcept
+{
+    // compared with SDL's target, not ours, which may name a destroyed texture
+    Status status = CheckView();
+    if (!status)
+        return status;
+    SDL_Texture* target = texture == nullptr ? nullptr : texture->Get();
+    if (state_.target == target)
+        return Status();
+
+    status = FlushDeferred();
+    if (!status)
+        return status;
+    status = RestoreClip();
+    if (!status)
+        return status;
+
+    {
+        SDL2WRAPPER_STATS_ADD(stats_, state_changes, 1);
+        SDL2WRAPPER_STATS_TIME(stats_, state_seconds);
+        if (0 != SDL_SetRenderTarget(renderer_.get(), target))
+            return Status("SDL_SetRenderTarget");
+    }
+    state_.target = target;
+    // SDL keeps a separate viewport, clip rect and scale per target
+    ResyncView();
+    return Status();
+}
+
+Status Renderer::TryDrawPoint(int x, int y) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(Rect(x, y, 1, 1), [&] { return TryDrawPoint(x, y); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, points, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawPoint(renderer_.get(), x, y))
+        return Status("SDL_RenderDrawPoint");
+    return Status();
+}
+
+Status Renderer::TryDrawPoints(const Point* points, int count) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(PointBounds(points, count), [&] { return TryDrawPoints(points, count); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, points, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawPoints(renderer_.get(), points, count))
+        return Status("SDL_RenderDrawPoints");
+    return Status();
+}
+
+Status Renderer::TryDrawLine(int x1, int y1, int x2, int y2) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(Rect::FromCorners(std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2)), [&] { return TryDrawLine(x1, y1, x2, y2); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, lines, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawLine(renderer_.get(), x1, y1, x2, y2))
+        return Status("SDL_RenderDrawLine");
+    return Status();
+}
+
+Status Renderer::TryDrawLines(const Point* points, int count) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(PointBounds(points, count), [&] { return TryDrawLines(points, count); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, lines, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawLines(renderer_.get(), points, count))
+        return Status("SDL_RenderDrawLines");
+    return Status();
+}
+
+Status Renderer::TryDrawRect(const Rect& rect) noexcept
+{
+    if (CullActive() && Culled(rect))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(rect, [&] { return TryDrawRect(rect); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, rects, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawRect(renderer_.get(), &rect))
+        return Status("SDL_RenderDrawRect");
+    return Status();
+}
+
+Status Renderer::TryDrawRects(const Rect* rects, int count) noexcept
+{
+    if (CullActive() && Culled(RectBounds(rects, count)))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(RectBounds(rects, count), [&] { return TryDrawRects(rects, count); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, rects, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawRects(renderer_.get(), rects, count))
+        return Status("SDL_RenderDrawRects");
+    return Status();
+}
+
+Status Renderer::TryFillRect(const Rect& rect) noexcept
+{
+    if (CullActive() && Culled(rect))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(rect, [&] { return TryFillRect(rect); });
+
+    if (deferred_)
+    {
+        draw_buffer_.AddFill(FRect(rect), state_.draw_color, state_.draw_blend, layer_);
+        return Status();
+    }
+
+    SDL2WRAPPER_STATS_ADD(stats_, fills, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderFillRect(renderer_.get(), &rect))
+        return Status("SDL_RenderFillRect");
+    return Status();
+}
+
+Status Renderer::TryFillRects(const Rect* rects, int count) noexcept
+{
+    if (CullActive() && Culled(RectBounds(rects, count)))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(RectBounds(rects, count), [&] { return TryFillRects(rects, count); });
+
+    if (deferred_)
+    {
+        for (const Rect* r = rects; r != rects + count; r++)
+            draw_buffer_.AddFill(FRect(*r), state_.draw_color, state_.draw_blend, layer_);
+        return Status();
+    }
+
+    SDL2WRAPPER_STATS_ADD(stats_, fills, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderFillRects(renderer_.get(), rects, count))
+        return Status("SDL_RenderFillRects");
+    return Status();
+}
+
+Status Renderer::TryDrawPoint(const FPoint& p) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(PointBounds(&p, 1), [&] { return TryDrawPoint(p); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, points, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawPointF(renderer_.get(), p.x, p.y))
+        return Status("SDL_RenderDrawPointF");
+    return Status();
+}
+
+Status Renderer::TryDrawPoints(const FPoint* points, int count) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(PointBounds(points, count), [&] { return TryDrawPoints(points, count); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, points, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawPointsF(renderer_.get(), points, count))
+        return Status("SDL_RenderDrawPointsF");
+    return Status();
+}
+
+Status Renderer::TryDrawLine(const FPoint& start, const FPoint& end) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(LineBounds(start, end), [&] { return TryDrawLine(start, end); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, lines, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawLineF(renderer_.get(), start.x, start.y, end.x, end.y))
+        return Status("SDL_RenderDrawLineF");
+    return Status();
+}
+
+Status Renderer::TryDrawLines(const FPoint* points, int count) noexcept
+{
+    if (DamageActive())
+        return DrawDamaged(PointBounds(points, count), [&] { return TryDrawLines(points, count); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, lines, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawLinesF(renderer_.get(), points, count))
+        return Status("SDL_RenderDrawLinesF");
+    return Status();
+}
+
+Status Renderer::TryDrawRect(const FRect& rect) noexcept
+{
+    if (CullActive() && Culled(rect.Enclosing()))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(rect.Enclosing(), [&] { return TryDrawRect(rect); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, rects, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawRectF(renderer_.get(), &rect))
+        return Status("SDL_RenderDrawRectF");
+    return Status();
+}
+
+Status Renderer::TryDrawRects(const FRect* rects, int count) noexcept
+{
+    if (CullActive() && Culled(RectBounds(rects, count)))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(RectBounds(rects, count), [&] { return TryDrawRects(rects, count); });
+
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, rects, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderDrawRectsF(renderer_.get(), rects, count))
+        return Status("SDL_RenderDrawRectsF");
+    return Status();
+}
+
+Status Renderer::TryFillRect(const FRect& rect) noexcept
+{
+    if (CullActive() && Culled(rect.Enclosing()))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(rect.Enclosing(), [&] { return TryFillRect(rect); });
+
+    if (deferred_)
+    {
+        draw_buffer_.AddFill(rect, state_.draw_color, state_.draw_blend, layer_);
+        return Status();
+    }
+
+    SDL2WRAPPER_STATS_ADD(stats_, fills, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderFillRectF(renderer_.get(), &rect))
+        return Status("SDL_RenderFillRectF");
+    return Status();
+}
+
+Status Renderer::TryFillRects(const FRect* rects, int count) noexcept
+{
+    if (CullActive() && Culled(RectBounds(rects, count)))
+        return Status();
+    if (DamageActive())
+        return DrawDamaged(RectBounds(rects, count), [&] { return TryFillRects(rects, count); });
+
+    if (deferred_)
+    {
+        for (const FRect* r = rects; r != rects + count; r++)
+            draw_buffer_.AddFill(*r, state_.draw_color, state_.draw_blend, layer_);
+        return Status();
+    }
+
+    SDL2WRAPPER_STATS_ADD(stats_, fills, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, primitive_seconds);
+    if (0 != SDL_RenderFillRectsF(renderer_.get(), rects, count))
+        return Status("SDL_RenderFillRectsF");
+    return Status();
+}
+
+Status Renderer::TryReadPixels(const SDL_Rect* rect, Uint32 format, void* pixels, int pitch) noexcept
+{
+    Status status = FlushDeferred();
+    if (!status)
+        return status;
+
+    SDL2WRAPPER_STATS_ADD(stats_, readbacks, 1);
+    SDL2WRAPPER_STATS_TIME(stats_, readback_seconds);
+    if (0 != SDL_RenderReadPixels(renderer_.get(), rect, format, pixels, pitch))
+        return Status("SDL_RenderReadPixels");
+    return Status();
+}
+
 Texture CreateTexture(Renderer& renderer, Uint32 format, int access, int w, int h)
 {
     SDL_Texture* texture = SDL_CreateTexture(renderer.Get(), format, access, w, h);
     if (texture == nullptr)
     {
-        throw SDLException("SDL_CreateTexture");
+        ThrowSDLException("SDL_CreateTexture");
     }
     return Texture(texture);
 }
@@ -566,7 +1706,7 @@ Texture CreateTexture(Renderer& renderer, const std::string& filename)
     SDL_Texture* texture = IMG_LoadTexture(renderer.Get(), filename.c_str());
     if (texture == nullptr)
     {
-        throw SDLException("IMG_LoadTexture");
+        ThrowSDLException("IMG_LoadTexture");
     }
     return Texture(texture);
 }
@@ -577,7 +1717,7 @@ Texture CreateTexture(Renderer& renderer, const Surface& surface)
     SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer.Get(), surface.Get());
     if (texture == nullptr)
     {
-        throw SDLException("SDL_CreateTextureFromSurface");
+        ThrowSDLException("SDL_CreateTextureFromSurface");
     }
     return Texture(texture);
 }
@@ -0,0 +1,108 @@
+#include "SDL2wrapper/include/RendererStats.h"
+
+#include <atomic>
+
+#include "SDL2/include/SDL_timer.h"
+
+namespace sdl2
+{
+namespace detail
+{
+
+namespace
+{
+
+#ifdef SDL2WRAPPER_STATS
+// texture locks are not tied to a Renderer, so they are counted globally and
+// attributed to the frame in which they happened
+std::atomic<Uint64> texture_locks{0};
+std::atomic<Uint64> texture_unlocks{0};
+#endif
+
+Uint64 TextureLocks()
+{
+#ifdef SDL2WRAPPER_STATS
+    return texture_locks.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+Uint64 TextureUnlocks()
+{
+#ifdef SDL2WRAPPER_STATS
+    return texture_unlocks.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+} // namespace
+
+StatsCollector::StatsCollector() :
+    texture_(nullptr), locks_base_(TextureLocks()), unlocks_base_(TextureUnlocks())
+{}
+
+RendererStats& StatsCollector::Current()
+{
+    return current_;
+}
+
+const RendererStats& StatsCollector::Current() const
+{
+    return current_;
+}
+
+const RendererStats& StatsCollector::Frame() const
+{
+    return frame_;
+}
+
+void StatsCollector::BindTexture(SDL_Texture* texture)
+{
+    if (texture != nullptr && texture != texture_)
+    {
+        ++current_.texture_switches;
+        texture_ = texture;
+    }
+}
+
+void StatsCollector::EndFrame()
+{
+    Uint64 locks = TextureLocks();
+    Uint64 unlocks = TextureUnlocks();
+    current_.texture_locks = locks - locks_base_;
+    current_.texture_unlocks = unlocks - unlocks_base_;
+    locks_base_ = locks;
+    unlocks_base_ = unlocks;
+
+    frame_ = current_;
+    current_ = RendererStats();
+}
+
+#ifdef SDL2WRAPPER_STATS
+
+StatsTimer::StatsTimer(double& seconds) :
+    seconds_(seconds), start_(SDL_GetPerformanceCounter())
+{}
+
+StatsTimer::~StatsTimer()
+{
+    seconds_ += static_cast<double>(SDL_GetPerformanceCounter() - start_) /
+        static_cast<double>(SDL_GetPerformanceFrequency());
+}
+
+void CountTextureLock()
+{
+    texture_locks.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CountTextureUnlock()
+{
+    texture_unlocks.fetch_add(1, std::memory_order_relaxed);
+}
+
+#endif
+
+} // detail
+} // sdl2
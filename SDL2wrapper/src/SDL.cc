@@ -12,7 +12,7 @@ SDL::SDL(Uint32 flags)
 {
     if (SDL_Init(flags) != 0)
     {
-        throw SDLException("SDL_Init");
+        ThrowSDLException("SDL_Init");
     }
 }
 
@@ -30,7 +30,7 @@ void SDL::InitSub(Uint32 flags)
 {
     if (SDL_InitSubSystem(flags) != 0)
     {
-        SDLException("SDL_InitSubSystem");
+        ThrowSDLException("SDL_InitSubSystem");
     }
 }
 
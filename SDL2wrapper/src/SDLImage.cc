@@ -10,7 +10,7 @@ namespace sdl2
 SDLImage::SDLImage(int flags)
 {
     if (flags != IMG_Init(flags) & flags)
-        throw SDLException("IMG_Init");
+        ThrowSDLException("IMG_Init");
 }
 
 SDLImage::~SDLImage()
@@ -22,7 +22,7 @@ int SDLImage::Formats(int flags)
 {
     int ret;
     if (flags != (ret = IMG_Init(flags) & flags))
-        throw SDLException("IMG_Init");
+        ThrowSDLException("IMG_Init");
     return ret;
 }
 
@@ -10,7 +10,7 @@ namespace sdl2
 SDLTTF::SDLTTF()
 {
     if (TTF_Init() != 0)
-        throw SDLException("TTF_Init()");
+        ThrowSDLException("TTF_Init()");
 }
 
 SDLTTF::~SDLTTF()
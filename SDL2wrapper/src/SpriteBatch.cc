@@ -0,0 +1,182 @@
+#include "SDL2wrapper/include/SpriteBatch.h"
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+SpriteBatch::SpriteBatch() :
+    texture_(nullptr), inv_width_(0.0f), inv_height_(0.0f), width_(0), height_(0)
+{}
+
+SpriteBatch::SpriteBatch(Texture& texture) : SpriteBatch()
+{
+    Reset(texture);
+}
+
+SpriteBatch& SpriteBatch::Reset(Texture& texture)
+{
+    Point size = texture.Size();
+    texture_ = texture.Get();
+    width_ = size.x;
+    height_ = size.y;
+    inv_width_ = 1.0f / width_;
+    inv_height_ = 1.0f / height_;
+    return Clear();
+}
+
+SpriteBatch& SpriteBatch::Clear()
+{
+    // the index pattern never changes, so only the vertices are dropped
+    vertices_.clear();
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::Reserve(int count)
+{
+    vertices_.reserve(static_cast<size_t>(count) * 4);
+    indices_.reserve(static_cast<size_t>(count) * 6);
+    return *this;
+}
+
+void SpriteBatch::AddQuad(const SDL_Rect& srcrect, const SDL_FRect& dstrect, const SDL_Color& color, int flip)
+{
+    if (dstrect.w <= 0.0f || dstrect.h <= 0.0f)
+        return;
+
+    // clip the source to the texture like SDL_RenderCopy does
+    SDL_Rect src = srcrect;
+    if (src.x < 0 || src.y < 0 || src.x + src.w > width_ || src.y + src.h > height_)
+    {
+        SDL_Rect full = {0, 0, width_, height_};
+        if (SDL_TRUE != SDL_IntersectRect(&srcrect, &full, &src))
+            return;
+    }
+
+    float u0 = src.x * inv_width_;
+    float v0 = src.y * inv_height_;
+    float u1 = (src.x + src.w) * inv_width_;
+    float v1 = (src.y + src.h) * inv_height_;
+    if (flip & SDL_FLIP_HORIZONTAL)
+        std::swap(u0, u1);
+    if (flip & SDL_FLIP_VERTICAL)
+        std::swap(v0, v1);
+
+    const float x0 = dstrect.x;
+    const float y0 = dstrect.y;
+    const float x1 = dstrect.x + dstrect.w;
+    const float y1 = dstrect.y + dstrect.h;
+
+    const int base = static_cast<int>(vertices_.size());
+    vertices_.push_back({{x0, y0}, color, {u0, v0}});
+    vertices_.push_back({{x1, y0}, color, {u1, v0}});
+    vertices_.push_back({{x1, y1}, color, {u1, v1}});
+    vertices_.push_back({{x0, y1}, color, {u0, v1}});
+
+    if (indices_.size() < vertices_.size() / 4 * 6)
+    {
+        indices_.push_back(base);
+        indices_.push_back(base + 1);
+        indices_.push_back(base + 2);
+        indices_.push_back(base);
+        indices_.push_back(base + 2);
+        indices_.push_back(base + 3);
+    }
+}
+
+SpriteBatch& SpriteBatch::Add(const Rect& srcrect, const Rect& dstrect)
+{
+    AddQuad(srcrect, FRect(dstrect), Color(255, 255, 255), 0);
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::Add(const Rect& srcrect, const Rect& dstrect, const Color& color)
+{
+    AddQuad(srcrect, FRect(dstrect), color, 0);
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::Add(const Rect& srcrect, const Rect& dstrect, const Color& color, int flip)
+{
+    AddQuad(srcrect, FRect(dstrect), color, flip);
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::Add(const Rect& srcrect, const FRect& dstrect)
+{
+    AddQuad(srcrect, dstrect, Color(255, 255, 255), 0);
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::Add(const Rect& srcrect, const FRect& dstrect, const Color& color)
+{
+    AddQuad(srcrect, dstrect, color, 0);
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::Add(const Rect& srcrect, const FRect& dstrect, const Color& color, int flip)
+{
+    AddQuad(srcrect, dstrect, color, flip);
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::Add(const CopyCommand* commands, int count)
+{
+    return Add(commands, count, Color(255, 255, 255));
+}
+
+SpriteBatch& SpriteBatch::Add(const CopyCommand* commands, int count, const Color& color)
+{
+    assert(texture_ != nullptr);
+
+    for (const CopyCommand* c = commands; c != commands + count; ++c)
+        AddQuad(c->srcrect, FRect(c->dstrect), color, 0);
+    return *this;
+}
+
+SDL_Texture* SpriteBatch::GetTexture() const
+{
+    return texture_;
+}
+
+int SpriteBatch::Size() const
+{
+    return static_cast<int>(vertices_.size() / 4);
+}
+
+bool SpriteBatch::Empty() const
+{
+    return vertices_.empty();
+}
+
+const SDL_Vertex* SpriteBatch::Vertices() const
+{
+    return vertices_.data();
+}
+
+int SpriteBatch::VertexCount() const
+{
+    return static_cast<int>(vertices_.size());
+}
+
+const int* SpriteBatch::Indices() const
+{
+    return indices_.data();
+}
+
+int SpriteBatch::IndexCount() const
+{
+    return Size() * 6;
+}
+
+} // sdl2
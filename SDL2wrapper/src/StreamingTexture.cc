@@ -0,0 +1,198 @@
+#include "SDL2wrapper/include/StreamingTexture.h"
+
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+#include "SDL2/include/SDL_stdinc.h"
+#include "SDL2/include/SDL_pixels.h"
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Status.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+StreamingTexture::WriteHandle::WriteHandle() :
+    owner_(nullptr), slot_(-1)
+{}
+
+StreamingTexture::WriteHandle::WriteHandle(StreamingTexture* owner, int slot) :
+    owner_(owner), slot_(slot)
+{}
+
+StreamingTexture::WriteHandle::~WriteHandle()
+{
+    if (owner_ != nullptr)
+        owner_->Publish(slot_);
+}
+
+StreamingTexture::WriteHandle::WriteHandle(WriteHandle&& other) noexcept :
+    owner_(other.owner_), slot_(other.slot_)
+{
+    other.owner_ = nullptr;
+    other.slot_ = -1;
+}
+
+StreamingTexture::WriteHandle& StreamingTexture::WriteHandle::operator=(WriteHandle&& other) noexcept
+{
+    if (&other == this)
+        return *this;
+    if (owner_ != nullptr)
+        owner_->Publish(slot_);
+
+    owner_ = other.owner_;
+    slot_ = other.slot_;
+
+    other.owner_ = nullptr;
+    other.slot_ = -1;
+
+    return *this;
+}
+
+StreamingTexture::WriteHandle::operator bool() const
+{
+    return owner_ != nullptr;
+}
+
+void* StreamingTexture::WriteHandle::Pixels() const
+{
+    return owner_ == nullptr ? nullptr : owner_->slots_[slot_].pixels.data();
+}
+
+int StreamingTexture::WriteHandle::Pitch() const
+{
+    return owner_ == nullptr ? 0 : owner_->pitch_;
+}
+
+StreamingTexture::StreamingTexture(Renderer& renderer, Uint32 format, int w, int h, int slots) :
+    texture_(CreateTexture(renderer, format, SDL_TEXTUREACCESS_STREAMING, w, h)),
+    pitch_(w * SDL_BYTESPERPIXEL(format)),
+    slots_(slots),
+    published_(0),
+    frame_(0)
+{
+    assert(slots > 0);
+    for (Slot& slot : slots_)
+        slot.pixels.resize(static_cast<size_t>(pitch_) * h);
+}
+
+StreamingTexture::WriteHandle StreamingTexture::Acquire() noexcept
+{
+    const int count = Slots();
+    for (int i = 0; i < count; ++i)
+    {
+        if (Claim(i, kFree, kWriting))
+            return WriteHandle(this, i);
+    }
+
+    // every slot is taken: the oldest published one is worth nothing once
+    // a newer one waits, so overwrite it
+    int oldest = -1;
+    int ready = 0;
+    Uint64 oldest_frame = std::numeric_limits<Uint64>::max();
+    for (int i = 0; i < count; ++i)
+    {
+        if (slots_[i].state.load(std::memory_order_relaxed) != kReady)
+            continue;
+        ++ready;
+        const Uint64 frame = slots_[i].frame.load(std::memory_order_relaxed);
+        if (frame < oldest_frame)
+        {
+            oldest = i;
+            oldest_frame = frame;
+        }
+    }
+    if (ready > 1 && Claim(oldest, kReady, kWriting))
+        return WriteHandle(this, oldest);
+
+    return WriteHandle();
+}
+
+Texture& StreamingTexture::Upload()
+{
+    ThrowIfFailed(TryUpload());
+    return texture_;
+}
+
+Status StreamingTexture::TryUpload() noexcept
+{
+    // claim every published slot, keep the newest and free the rest
+    int newest = -1;
+    Uint64 newest_frame = frame_;
+    for (int i = 0; i < Slots(); ++i)
+    {
+        if (!Claim(i, kReady, kUploading))
+            continue;
+
+        const Uint64 frame = slots_[i].frame.load(std::memory_order_relaxed);
+        if (frame <= newest_frame)
+        {
+            slots_[i].state.store(kFree, std::memory_order_release);
+            continue;
+        }
+        if (newest >= 0)
+            slots_[newest].state.store(kFree, std::memory_order_release);
+        newest = i;
+        newest_frame = frame;
+    }
+    if (newest < 0)
+        return Status();
+
+    Status status = texture_.TryUpdate(nullptr, slots_[newest].pixels.data(), pitch_);
+    if (status)
+    {
+        frame_ = newest_frame;
+        slots_[newest].state.store(kFree, std::memory_order_release);
+    }
+    else
+    {
+        // try again next time
+        slots_[newest].state.store(kReady, std::memory_order_release);
+    }
+    return status;
+}
+
+Texture& StreamingTexture::Get()
+{
+    return texture_;
+}
+
+int StreamingTexture::Slots() const
+{
+    return static_cast<int>(slots_.size());
+}
+
+int StreamingTexture::Pitch() const
+{
+    return pitch_;
+}
+
+Uint64 StreamingTexture::Published() const
+{
+    return published_.load(std::memory_order_relaxed);
+}
+
+Uint64 StreamingTexture::Frame() const
+{
+    return frame_;
+}
+
+bool StreamingTexture::Claim(int slot, State from, State to) noexcept
+{
+    int expected = from;
+    return slots_[slot].state.compare_exchange_strong(
+        expected, to, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+void StreamingTexture::Publish(int slot) noexcept
+{
+    const Uint64 frame = published_.fetch_add(1, std::memory_order_relaxed) + 1;
+    slots_[slot].frame.store(frame, std::memory_order_relaxed);
+    slots_[slot].state.store(kReady, std::memory_order_release);
+}
+
+} // sdl2
@@ -9,6 +9,7 @@
 #include "SDL2_image/include/SDL_image.h"
 
 #include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/Status.h"
 
 namespace sdl2
 {
@@ -23,7 +24,7 @@ Surface::Surface(Uint32 flags, int width, int height, int depth,
 {
     surface_ = SurfaceSharedPtr(SDL_CreateRGBSurface(flags, width, height, depth, Rm, Gm, Bm, Am));
     if (surface_ == nullptr)
-        throw SDLException("SDL_CreateRGBSurface");
+        ThrowSDLException("SDL_CreateRGBSurface");
 }
 
 Surface::Surface(void* pixels, int widht, int height, int depth, int pitch,
@@ -31,7 +32,7 @@ Surface::Surface(void* pixels, int widht, int height, int depth, int pitch,
 {
     surface_ =  SurfaceSharedPtr(SDL_CreateRGBSurfaceFrom(pixels, widht, height, depth, pitch, Rm, Gm, Bm, Am));
     if (surface_ == nullptr)
-        throw SDLException("SDL_CreateRGBSurfaceFrom");
+        ThrowSDLException("SDL_CreateRGBSurfaceFrom");
 }
 
 #ifdef SDL2WRAPPER_IMAGE
@@ -39,7 +40,7 @@ Surface::Surface(const std::string& path)
 {
     surface_ = SurfaceSharedPtr(IMG_Load(path.c_str()));
     if (surface_ == nullptr)
-        throw SDLException("IMG_Load");
+        ThrowSDLException("IMG_Load");
 }
 #endif
 
@@ -65,7 +66,7 @@ Surface Surface::Convert(const SDL_PixelFormat& format)
 {
     SDL_Surface* surface = SDL_ConvertSurface(&*surface_, &format, 0);
     if (surface == nullptr)
-        throw SDLException("SDL_ConvertSurface");
+        ThrowSDLException("SDL_ConvertSurface");
     return Surface(surface);
 }
 
@@ -73,23 +74,14 @@ Surface Surface::Convert(Uint32 pixel_format)
 {
     SDL_Surface* surface = SDL_ConvertSurfaceFormat(&*surface_, pixel_format, 0);
     if (surface == nullptr)
-        throw SDLException("SDL_ConvertSurface");
+        ThrowSDLException("SDL_ConvertSurface");
     return Surface(surface);
 }
 
 void Surface::Blit(const std::optional<Rect>& srcrect, Surface& dst, const Rect& dstrect)
 {
     SDL_Rect tmpdstrect = dstrect;
-    SDL_Surface* dstsurface = &*(dst.Get());
-    if (0 != SDL_BlitSurface(
-            &*surface_, 
-            srcrect == std::nullopt ? nullptr : &*srcrect,
-            dstsurface, 
-            &tmpdstrect
-    ))
-    {
-        throw SDLException("SDL_BlitSurface");
-    }
+    ThrowIfFailed(TryBlit(srcrect == std::nullopt ? nullptr : &*srcrect, dst, &tmpdstrect));
 }
 
 void Surface::BlitScaled(const std::optional<Rect>& srcrect, Surface& dst, const std::optional<Rect>& dstrect)
@@ -97,21 +89,18 @@ void Surface::BlitScaled(const std::optional<Rect>& srcrect, Surface& dst, const
     SDL_Rect tmpdstrect;
     if (dstrect != std::nullopt)
         tmpdstrect = *dstrect;
-    SDL_Surface* dstsurface = &*(dst.Get());
-    if (0 != SDL_BlitScaled(
-            &*surface_,
-            srcrect == std::nullopt ? nullptr : &*srcrect,
-            dstsurface,
-            dstrect == std::nullopt ? nullptr : &tmpdstrect
-    ))
-    {
-        throw SDLException("SDL_BlitScaled");
-    }
+    ThrowIfFailed(TryBlitScaled(
+        srcrect == std::nullopt ? nullptr : &*srcrect,
+        dst,
+        dstrect == std::nullopt ? nullptr : &tmpdstrect
+    ));
 }
 
 Surface::LockHandle Surface::Lock()
 {
-    return LockHandle(this);
+    LockHandle handle;
+    ThrowIfFailed(TryLock(handle));
+    return handle;
 }
 
 Rect Surface::ClipRect() const
@@ -125,7 +114,7 @@ Uint32 Surface::ColorKey() const
 {
     Uint32 key;
     if (0 != SDL_GetColorKey(&*surface_, &key))
-        throw SDLException("SDL_GetColorKey");
+        ThrowSDLException("SDL_GetColorKey");
     return key;
 }
 
@@ -133,7 +122,7 @@ Uint8 Surface::AlphaMod() const
 {
     Uint8 alpha;
     if (0 != SDL_GetSurfaceAlphaMod(&*surface_, &alpha))
-        throw SDLException("SDL_GetSurfaceAlphaMod");
+        ThrowSDLException("SDL_GetSurfaceAlphaMod");
     return alpha;
 }
 
@@ -141,7 +130,7 @@ SDL_BlendMode Surface::BlendMode() const
 {
     SDL_BlendMode blend;
     if (0 != SDL_GetSurfaceBlendMode(&*surface_, &blend))
-        throw SDLException("SDL_GetSurfaceBlendMode");
+        ThrowSDLException("SDL_GetSurfaceBlendMode");
     return blend;
 }
 
@@ -156,7 +145,7 @@ Color Surface::ColorAndAlphaMod() const
 void Surface::ColorMod(Uint8& r, Uint8& g, Uint8& b) const
 {
     if (0 != SDL_GetSurfaceColorMod(&*surface_, &r, &g, &b))
-        throw SDLException("SDL_GetSurfaceColorMod");
+        ThrowSDLException("SDL_GetSurfaceColorMod");
 }
 
 Surface& Surface::ClipRect(const std::optional<Rect>& rect)
@@ -166,7 +155,7 @@ Surface& Surface::ClipRect(const std::optional<Rect>& rect)
         rect == std::nullopt ? nullptr : &*rect
     ))
     {
-        throw SDLException("SDL_SetClipRect");
+        ThrowSDLException("SDL_SetClipRect");
     }
     return *this;
 }
@@ -174,28 +163,28 @@ Surface& Surface::ClipRect(const std::optional<Rect>& rect)
 Surface& Surface::ColorKey(bool flag, Uint32 key)
 {
     if (0 != SDL_SetColorKey(&*surface_, flag, key))
-        throw SDLException("SDL_SetColorKey");
+        ThrowSDLException("SDL_SetColorKey");
     return *this;
 }
 
 Surface& Surface::AlphaMod(Uint8 alpha)
 {
     if (0 != SDL_SetSurfaceAlphaMod(&*surface_, alpha))
-        throw SDLException("SDL_SetSurfaceAlphaMod");
+        ThrowSDLException("SDL_SetSurfaceAlphaMod");
     return *this;
 }
 
 Surface& Surface::BlendMode(SDL_BlendMode blendMode)
 {
     if (0 != SDL_SetSurfaceBlendMode(&*surface_, blendMode))
-        throw SDLException("SDL_SetSurfaceBlendMode");
+        ThrowSDLException("SDL_SetSurfaceBlendMode");
     return *this;
 }
 
 Surface& Surface::ColorMod(Uint8 r, Uint8 g, Uint8 b)
 {
     if (0 != SDL_SetSurfaceColorMod(&*surface_, r, g, b))
-        throw SDLException("SDL_SetSurfaceColorMod");
+        ThrowSDLException("SDL_SetSurfaceColorMod");
     return *this;
 }
 
@@ -207,33 +196,27 @@ Surface& Surface::ColorAndAlphaMod(const Color& color)
 Surface& Surface::RLE(bool flag)
 {
     if (SDL_SetSurfaceRLE(&*surface_, flag ? 1 : 0) != 0)
-        throw SDLException("SDL_SetSurfaceRLE");
+        ThrowSDLException("SDL_SetSurfaceRLE");
     return *this;
 }
 
 Surface& Surface::FillRect(const std::optional<Rect>& rect, Uint32 color)
 {
-    if (0 != SDL_FillRect(
-        &*surface_,
-        rect == std::nullopt ? nullptr : &*rect,
-        color
-    ))
-        throw SDLException("SDL_FillRect");
+    ThrowIfFailed(TryFillRect(rect == std::nullopt ? nullptr : &*rect, color));
     return *this;
 }
 
 Surface& Surface::FillRects(const Rect* rects, int count, Uint32 color)
 {
-    std::vector<SDL_Rect> sdl_rects;
-    sdl_rects.reserve(static_cast<size_t>(count));
-    for (const Rect* r = rects; r != rects + count; ++r)
-        sdl_rects.emplace_back(*r);
-
-    if (0 != SDL_FillRects(&*surface_, sdl_rects.data(), count, color))
-        throw SDLException("SDL_FillRects");
+    ThrowIfFailed(TryFillRects(rects, count, color));
     return *this;
 }
 
+Surface& Surface::FillRects(const std::vector<Rect>& rects, Uint32 color)
+{
+    return FillRects(rects.data(), static_cast<int>(rects.size()), color);
+}
+
 Point Surface::Size() const
 {
     return Point(surface_->w, surface_->h);
@@ -254,4 +237,40 @@ Uint32 Surface::Format() const
     return surface_->format->format;
 }
 
+Status Surface::TryBlit(const SDL_Rect* srcrect, Surface& dst, SDL_Rect* dstrect) noexcept
+{
+    if (0 != SDL_BlitSurface(&*surface_, srcrect, dst.Get(), dstrect))
+        return Status("SDL_BlitSurface");
+    return Status();
+}
+
+Status Surface::TryBlitScaled(const SDL_Rect* srcrect, Surface& dst, SDL_Rect* dstrect) noexcept
+{
+    if (0 != SDL_BlitScaled(&*surface_, srcrect, dst.Get(), dstrect))
+        return Status("SDL_BlitScaled");
+    return Status();
+}
+
+Status Surface::TryFillRect(const SDL_Rect* rect, Uint32 color) noexcept
+{
+    if (0 != SDL_FillRect(&*surface_, rect, color))
+        return Status("SDL_FillRect");
+    return Status();
+}
+
+Status Surface::TryFillRects(const Rect* rects, int count, Uint32 color) noexcept
+{
+    if (0 != SDL_FillRects(&*surface_, rects, count, color))
+        return Status("SDL_FillRects");
+    return Status();
+}
+
+Status Surface::TryLock(LockHandle& handle) noexcept
+{
+    if (SDL_MUSTLOCK(surface_.get()) && 0 != SDL_LockSurface(surface_.get()))
+        return Status("SDL_LockSurface");
+    handle = LockHandle(this);
+    return Status();
+}
+
 } // sdl2
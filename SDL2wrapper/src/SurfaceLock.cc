@@ -4,24 +4,20 @@
 
 #include "SDL2/include/SDL_surface.h"
 
-#include "SDL2wrapper/include/Exception.h"
-
 namespace sdl2
 {
 
 Surface::LockHandle::LockHandle() : surface_(nullptr) {
 }
 
+// adopts a lock taken by Surface::TryLock
 Surface::LockHandle::LockHandle(Surface* surface) : surface_(surface) {
-    if (SDL_MUSTLOCK(surface_->Get())) {
-        if (SDL_LockSurface(surface_->Get()))
-            throw SDLException("SDL_LockSurface");
-    }
 }
 
 Surface::LockHandle::LockHandle(Surface::LockHandle&& other) noexcept 
-    : surface_(std::move(other.surface_)) 
+    : surface_(other.surface_) 
 {
+    other.surface_ = nullptr;
 }
 
 Surface::LockHandle& Surface::LockHandle::operator=(Surface::LockHandle&& other) noexcept {
@@ -33,7 +29,8 @@ Surface::LockHandle& Surface::LockHandle::operator=(Surface::LockHandle&& other)
             SDL_UnlockSurface(surface_->Get());
     }
 
-    surface_ = std::move(other.surface_);
+    surface_ = other.surface_;
+    other.surface_ = nullptr;
 
     return *this;
     }
@@ -1,17 +1,59 @@
 #include "SDL2wrapper/include/Texture.h"
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
+#include <vector>
 
+#include "SDL2/include/SDL_pixels.h"
+#include "SDL2/include/SDL_surface.h"
 
 #include "SDL2wrapper/include/Pointers.h"
 #include "SDL2wrapper/include/Rect.h"
 #include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/Status.h"
 #include "SDL2wrapper/include/Surface.h"
 
 namespace sdl2
 {
 
+namespace
+{
+
+// patches up to this many bytes share one buffer per thread
+constexpr size_t kRetainedStaging = 4 << 20;
+
+// Scratch space for converted pixels. Larger patches get a buffer of their
+// own, freed with it, so one big update does not pin memory for the life
+// of the thread.
+class Staging
+{
+public:
+    explicit Staging(size_t size) :
+        buffer_(size <= kRetainedStaging ? Shared() : own_)
+    {
+        if (buffer_.size() < size)
+            buffer_.resize(size);
+    }
+
+    Uint8* Data()
+    {
+        return buffer_.data();
+    }
+
+private:
+    static std::vector<Uint8>& Shared()
+    {
+        thread_local std::vector<Uint8> shared;
+        return shared;
+    }
+
+    std::vector<Uint8> own_;
+    std::vector<Uint8>& buffer_;
+};
+
+} // namespace
+
 Texture::Texture(SDL_Texture* texture) : texture_(texture)
 {
     assert(texture);
@@ -40,61 +82,87 @@ SDL_Texture* Texture::Get() const
 
 Texture& Texture::Update(const std::optional<Rect>& rect, const void* pixels, int pitch)
 {
-    if (0 != SDL_UpdateTexture(
-        texture_.get(),
-        rect == std::nullopt ? nullptr : &*rect,
-        pixels, pitch
-    ))
-    {
-        throw SDLException("SDL_UpdateTexture");
-    }
-
+    ThrowIfFailed(TryUpdate(rect == std::nullopt ? nullptr : &*rect, pixels, pitch));
     return *this;
 }
 
+// Only the w x h patch at the surface origin that lands in the texture is
+// converted: straight into the texture when it is streaming, otherwise
+// into a staging buffer, see Staging.
 Texture& Texture::Update(const std::optional<Rect>& rect, Surface& surface)
 {
-    Rect real_rect = rect == std::nullopt ? Rect(0, 0, Width(), Height()) : *rect;
+    Uint32 format;
+    int access, w, h;
+    if (0 != SDL_QueryTexture(texture_.get(), &format, &access, &w, &h))
+    {
+        ThrowSDLException("SDL_QueryTexture");
+    }
+
+    Rect real_rect = rect == std::nullopt ? Rect(0, 0, w, h) : *rect;
 
     real_rect.w = std::min(real_rect.w, surface.Width());
     real_rect.h = std::min(real_rect.h, surface.Height());
+    if (real_rect.w <= 0 || real_rect.h <= 0)
+        return *this;
+
+    Surface::LockHandle source = surface.Lock();
+    const SDL_PixelFormat& source_format = *surface.Get()->format;
+    if (format == source_format.format)
+        return Update(real_rect, source.Pixels(), source.Pitch());
 
-    if (Format() == surface.Format())
+    // SDL_ConvertPixels knows nothing of palettes and color keys, so those
+    // go through SDL_ConvertSurface, on a surface that views just the patch
+    Uint32 key;
+    const bool keyed = 0 == SDL_GetColorKey(surface.Get(), &key);
+    if (keyed || SDL_ISPIXELFORMAT_INDEXED(source_format.format) || SDL_ISPIXELFORMAT_FOURCC(format))
     {
-        Surface::LockHandle lock = surface.Lock();
+        SDL_Surface* view = SDL_CreateRGBSurfaceWithFormatFrom(
+            source.Pixels(), real_rect.w, real_rect.h,
+            source_format.BitsPerPixel, source.Pitch(), source_format.format
+        );
+        if (view == nullptr)
+            ThrowSDLException("SDL_CreateRGBSurfaceWithFormatFrom");
+        Surface patch(view);
+        if (source_format.palette != nullptr && 0 != SDL_SetSurfacePalette(view, source_format.palette))
+            ThrowSDLException("SDL_SetSurfacePalette");
+        if (keyed && 0 != SDL_SetColorKey(view, SDL_TRUE, key))
+            ThrowSDLException("SDL_SetColorKey");
+
+        Surface converted = patch.Convert(format);
+        Surface::LockHandle lock = converted.Lock();
         return Update(real_rect, lock.Pixels(), lock.Pitch());
     }
-    else
+
+    if (access == SDL_TEXTUREACCESS_STREAMING)
     {
-        Surface converted = surface.Convert(Format());
-        Surface::LockHandle lock = converted.Lock();
+        LockHandle lock = Lock(real_rect);
+        if (0 != SDL_ConvertPixels(
+            real_rect.w, real_rect.h,
+            source_format.format, source.Pixels(), source.Pitch(),
+            format, lock.Pixels(), lock.Pitch()
+        ))
+        {
+            ThrowSDLException("SDL_ConvertPixels");
+        }
+        return *this;
+    }
 
-        return Update(real_rect, lock.Pixels(), lock.Pitch());
+    const int pitch = real_rect.w * SDL_BYTESPERPIXEL(format);
+    Staging staging(static_cast<size_t>(pitch) * real_rect.h);
+    if (0 != SDL_ConvertPixels(
+        real_rect.w, real_rect.h,
+        source_format.format, source.Pixels(), source.Pitch(),
+        format, staging.Data(), pitch
+    ))
+    {
+        ThrowSDLException("SDL_ConvertPixels");
     }
+    return Update(real_rect, staging.Data(), pitch);
 }
 
 Texture& Texture::Update(const std::optional<Rect>& rect, Surface&& surface)
 {
-    Rect real_rect = (rect == std::nullopt) ? Rect(0, 0, Width(), Height()) : *rect;
-
-    real_rect.w = std::min(real_rect.w, surface.Width());
-    real_rect.h = std::min(real_rect.h, surface.Height());
-
-    if (Format() == surface.Format())
-    {
-        Surface::LockHandle lock = surface.Lock();
-        return Update(real_rect, lock.Pixels(), lock.Pitch());
-    }
-    else
-    {
-        Surface converted = surface.Convert(Format());
-        Surface::LockHandle lock = converted.Lock();
-      
-        void* p = lock.Pixels();
-        int i = lock.Pitch();
-
-        return Update(real_rect, lock.Pixels(), lock.Pitch());
-    }
+    return Update(rect, surface);
 }
 
 Texture& Texture::UpdateYUV(
@@ -112,35 +180,26 @@ Texture& Texture::UpdateYUV(
         vplane, vpitch
     ))
     {
-        throw SDLException("SDL_UpdateYUVTexture");
+        ThrowSDLException("SDL_UpdateYUVTexture");
     }
     return *this;
 }
 
 Texture& Texture::BlendMode(SDL_BlendMode blendMode)
 {
-    if (0 != SDL_SetTextureBlendMode(texture_.get(), blendMode))
-    {
-        throw SDLException("SDL_SetTextureBlendMode");
-    }
+    ThrowIfFailed(TryBlendMode(blendMode));
     return *this;
 }
 
 Texture& Texture::AlphaMod(Uint8 alpha)
 {
-    if (0 != SDL_SetTextureAlphaMod(texture_.get(), alpha))
-    {
-        throw SDLException("SDL_SetTextureAlphaMod");
-    }
+    ThrowIfFailed(TryAlphaMod(alpha));
     return *this;
 }
 
 Texture& Texture::SetColorMod(Uint8 r, Uint8 g, Uint8 b)
 {
-    if (0 != SDL_SetTextureColorMod(texture_.get(), r, g, b))
-    {
-        throw SDLException("SDL_SetTextureColorMod");
-    }
+    ThrowIfFailed(TrySetColorMod(r, g, b));
     return *this;
 }
 
@@ -151,7 +210,9 @@ Texture& Texture::ColorAndAlphaMod(const Color& color)
 
 Texture::LockHandle Texture::Lock(const std::optional<Rect>& rect)
 {
-    return LockHandle(this, rect);
+    LockHandle handle;
+    ThrowIfFailed(TryLock(handle, rect == std::nullopt ? nullptr : &*rect));
+    return handle;
 }
 
 Uint32 Texture::Format() const
@@ -159,7 +220,7 @@ Uint32 Texture::Format() const
     Uint32 format;
     if (0 != SDL_QueryTexture(texture_.get(), &format, nullptr, nullptr, nullptr))
     {
-        throw SDLException("SDL_QueryTexture");
+        ThrowSDLException("SDL_QueryTexture");
     }
     return format;
 }
@@ -169,7 +230,7 @@ int Texture::Access() const
     int access;
     if (0 != SDL_QueryTexture(texture_.get(), nullptr, &access, nullptr, nullptr))
     {
-        throw SDLException("SDL_QueryTexture");
+        ThrowSDLException("SDL_QueryTexture");
     }
     return access;
 }
@@ -179,7 +240,7 @@ int Texture::Width() const
     int width;
     if (0 != SDL_QueryTexture(texture_.get(), nullptr, nullptr, &width, nullptr))
     {
-        throw SDLException("SDL_QueryTexture");
+        ThrowSDLException("SDL_QueryTexture");
     }
     return width;
 }
@@ -189,7 +250,7 @@ int Texture::Height() const
     int height;
     if (0 != SDL_QueryTexture(texture_.get(), nullptr, nullptr, nullptr, &height))
     {
-        throw SDLException("SDL_QueryTexture");
+        ThrowSDLException("SDL_QueryTexture");
     }
     return height;
 }
@@ -199,7 +260,7 @@ Point Texture::Size() const
     int w, h;
     if (0 != SDL_QueryTexture(texture_.get(), nullptr, nullptr, &w, &h))
     {
-        throw SDLException("SDL_QueryTexture");
+        ThrowSDLException("SDL_QueryTexture");
     }
     return Point(w, h);
 }
@@ -209,7 +270,7 @@ Uint8 Texture::AlphaMod() const
     Uint8 alpha;
     if (0 != SDL_GetTextureAlphaMod(texture_.get(), &alpha))
     {
-        throw SDLException("SDL_GetTextureAlphaMod");
+        ThrowSDLException("SDL_GetTextureAlphaMod");
     }
     return alpha;
 }
@@ -219,7 +280,7 @@ SDL_BlendMode Texture::BlendMode() const
     SDL_BlendMode blend;
     if (0 != SDL_GetTextureBlendMode(texture_.get(), &blend))
     {
-        throw SDLException("SDL_GetTextureBlendMode");
+        ThrowSDLException("SDL_GetTextureBlendMode");
     }
     return blend;
 }
@@ -228,7 +289,7 @@ void Texture::GetColorMod(Uint8& r, Uint8& g, Uint8& b)
 {
     if (0 != SDL_GetTextureColorMod(texture_.get(), &r, &g, &b))
     {
-        throw SDLException("SDL_GetTextureColorMod");
+        ThrowSDLException("SDL_GetTextureColorMod");
     }
 }
 
@@ -240,4 +301,50 @@ Color Texture::ColorAndAlphaMod()
     return color;
 }
 
+Status Texture::TryUpdate(const SDL_Rect* rect, const void* pixels, int pitch) noexcept
+{
+    if (0 != SDL_UpdateTexture(texture_.get(), rect, pixels, pitch))
+        return Status("SDL_UpdateTexture");
+    return Status();
+}
+
+Status Texture::TryBlendMode(SDL_BlendMode blendMode) noexcept
+{
+    if (0 != SDL_SetTextureBlendMode(texture_.get(), blendMode))
+        return Status("SDL_SetTextureBlendMode");
+    return Status();
+}
+
+Status Texture::TryAlphaMod(Uint8 alpha) noexcept
+{
+    if (0 != SDL_SetTextureAlphaMod(texture_.get(), alpha))
+        return Status("SDL_SetTextureAlphaMod");
+    return Status();
+}
+
+Status Texture::TrySetColorMod(Uint8 r, Uint8 g, Uint8 b) noexcept
+{
+    if (0 != SDL_SetTextureColorMod(texture_.get(), r, g, b))
+        return Status("SDL_SetTextureColorMod");
+    return Status();
+}
+
+Status Texture::TryColorAndAlphaMod(const Color& color) noexcept
+{
+    Status status = TrySetColorMod(color.r, color.g, color.b);
+    if (!status)
+        return status;
+    return TryAlphaMod(color.a);
+}
+
+Status Texture::TryLock(LockHandle& handle, const SDL_Rect* rect) noexcept
+{
+    void* pixels;
+    int pitch;
+    if (0 != SDL_LockTexture(texture_.get(), rect, &pixels, &pitch))
+        return Status("SDL_LockTexture");
+    handle = LockHandle(this, pixels, pitch);
+    return Status();
+}
+
 } //sdl2
@@ -0,0 +1,144 @@
+#include "SDL2wrapper/include/TextureAtlas.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include "SDL2/include/SDL_pixels.h"
+#include "SDL2/include/SDL_render.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectPacker.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+namespace sdl2
+{
+
+TextureAtlas::TextureAtlas(Renderer& renderer, int page_width, int page_height, int padding, Uint32 format) :
+    renderer_(&renderer), page_width_(page_width), page_height_(page_height),
+    padding_(std::max(padding, 0)), format_(format)
+{
+    SDL_RendererInfo info;
+    renderer.GetInfo(info);
+    // 0 means the renderer has no limit
+    if (info.max_texture_width > 0)
+        page_width_ = std::min(page_width_, info.max_texture_width);
+    if (info.max_texture_height > 0)
+        page_height_ = std::min(page_height_, info.max_texture_height);
+}
+
+std::optional<TextureAtlas::Region> TextureAtlas::Insert(Surface& surface)
+{
+    std::optional<Region> region = Place(surface.Width(), surface.Height());
+    if (region != std::nullopt)
+        Page(*region).Update(region->rect, surface);
+    return region;
+}
+
+std::vector<std::optional<TextureAtlas::Region>> TextureAtlas::Insert(const std::vector<Surface*>& surfaces)
+{
+    std::vector<int> order(surfaces.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&surfaces](int a, int b) {
+        const Surface& sa = *surfaces[a];
+        const Surface& sb = *surfaces[b];
+        return std::max(sa.Width(), sa.Height()) > std::max(sb.Width(), sb.Height());
+    });
+
+    std::vector<std::optional<Region>> regions(surfaces.size());
+    for (int i : order)
+        regions[i] = Insert(*surfaces[i]);
+    return regions;
+}
+
+TextureAtlas& TextureAtlas::Clear()
+{
+    pages_.clear();
+    return *this;
+}
+
+std::optional<TextureAtlas::Region> TextureAtlas::Place(int w, int h)
+{
+    if (w <= 0 || h <= 0 || w > page_width_ || h > page_height_)
+        return std::nullopt;
+
+    // the packers are padding larger than the page, so a region can touch
+    // the right and bottom edges while keeping padding to its neighbours
+    for (std::size_t i = 0; i < pages_.size(); ++i)
+    {
+        if (std::optional<Rect> r = pages_[i].packer.Insert(w + padding_, h + padding_))
+            return Region{static_cast<int>(i), Rect(r->x, r->y, w, h)};
+    }
+
+    AtlasPage& page = AddPage();
+    std::optional<Rect> r = page.packer.Insert(w + padding_, h + padding_);
+    assert(r != std::nullopt);
+    return Region{static_cast<int>(pages_.size()) - 1, Rect(r->x, r->y, w, h)};
+}
+
+TextureAtlas::AtlasPage& TextureAtlas::AddPage()
+{
+    Texture texture = CreateTexture(*renderer_, format_, SDL_TEXTUREACCESS_STATIC, page_width_, page_height_);
+    texture.BlendMode(SDL_BLENDMODE_BLEND);
+
+    // start fully transparent so padding never shows garbage
+    const int pitch = page_width_ * SDL_BYTESPERPIXEL(format_);
+    std::vector<Uint8> zeros(static_cast<size_t>(pitch) * page_height_);
+    texture.Update(std::nullopt, zeros.data(), pitch);
+
+    pages_.push_back(AtlasPage{
+        std::move(texture),
+        RectPacker(page_width_ + padding_, page_height_ + padding_)
+    });
+    return pages_.back();
+}
+
+Texture& TextureAtlas::Page(int index)
+{
+    assert(index >= 0 && index < PageCount());
+    return pages_[index].texture;
+}
+
+Texture& TextureAtlas::Page(const Region& region)
+{
+    return Page(region.page);
+}
+
+int TextureAtlas::PageCount() const
+{
+    return static_cast<int>(pages_.size());
+}
+
+int TextureAtlas::PageWidth() const
+{
+    return page_width_;
+}
+
+int TextureAtlas::PageHeight() const
+{
+    return page_height_;
+}
+
+int TextureAtlas::Padding() const
+{
+    return padding_;
+}
+
+Uint32 TextureAtlas::Format() const
+{
+    return format_;
+}
+
+double TextureAtlas::Occupancy(int index) const
+{
+    assert(index >= 0 && index < PageCount());
+    const RectPacker& packer = pages_[index].packer;
+    // the packer counts padding as used and is larger than the page
+    return packer.Occupancy() * packer.Width() * packer.Height() / (static_cast<double>(page_width_) * page_height_);
+}
+
+} // sdl2
@@ -3,7 +3,7 @@
 #include "SDL2/include/SDL_render.h"
 
 #include "SDL2wrapper/include/Rect.h"
-#include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/RendererStats.h"
 
 namespace sdl2
 {
@@ -12,17 +12,12 @@ Texture::LockHandle::LockHandle():
     texture_(nullptr), pixels_(nullptr), pitch_(0)
 {}
 
-Texture::LockHandle::LockHandle(Texture* texture, const std::optional<Rect>& rect):
-    texture_(texture)
+Texture::LockHandle::LockHandle(Texture* texture, void* pixels, int pitch):
+    texture_(texture), pixels_(pixels), pitch_(pitch)
 {
-    if (0 != SDL_LockTexture(
-        texture_->Get(), 
-        rect == std::nullopt ? nullptr : &*rect,
-        &pixels_, &pitch_
-    ))
-    {
-        throw SDLException("SDL_LockTexture");
-    }
+#ifdef SDL2WRAPPER_STATS
+    detail::CountTextureLock();
+#endif
 }
 
 Texture::LockHandle::LockHandle(Texture::LockHandle&& other) noexcept 
@@ -38,7 +33,12 @@ Texture::LockHandle& Texture::LockHandle::operator=(Texture::LockHandle&& other)
     if (&other == this)
         return *this;
     if (texture_ != nullptr)
+    {
         SDL_UnlockTexture(texture_->Get());
+#ifdef SDL2WRAPPER_STATS
+        detail::CountTextureUnlock();
+#endif
+    }
     
     texture_ = other.texture_;
     pixels_ = other.pixels_;
@@ -55,7 +55,12 @@ Texture::LockHandle& Texture::LockHandle::operator=(Texture::LockHandle&& other)
 Texture::LockHandle::~LockHandle()
 {
     if (texture_ != nullptr)
+    {
         SDL_UnlockTexture(texture_->Get());
+#ifdef SDL2WRAPPER_STATS
+        detail::CountTextureUnlock();
+#endif
+    }
 }
 
 void* Texture::LockHandle::Pixels() const
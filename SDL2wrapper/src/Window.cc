@@ -15,7 +15,7 @@ Window::Window(const std::string& title, int x, int y, int w, int h, Uint32 flag
 {
     window_ = WindowPtr(SDL_CreateWindow(title.c_str(), x, y ,w, h, flags));
     if (window_ == nullptr)
-        throw SDLException("SDL_CreateWindow");
+        ThrowSDLException("SDL_CreateWindow");
 }
 
 SDL_Window* Window::Get() const
@@ -115,7 +115,7 @@ Window& Window::Show()
 Window& Window::Fullscreen(Uint32 flags)
 {
     if (SDL_SetWindowFullscreen(&*window_, flags) != 0)
-        throw SDLException("SDL_SetWindowFullscreen");
+        ThrowSDLException("SDL_SetWindowFullscreen");
     return *this;
 }
 
@@ -139,7 +139,7 @@ float Window::Brightness() const
 Window& Window::Brightness(float brightness)
 {
     if (SDL_SetWindowBrightness(&*window_, brightness) != 0)
-        throw SDLException("SDL_SetWindowBrightness");
+        ThrowSDLException("SDL_SetWindowBrightness");
     return *this;
 }
 
@@ -215,14 +215,14 @@ int Window::DisplayIndex() const
 {
     int index = SDL_GetWindowDisplayIndex(&*window_);
     if (index < 0)
-        throw SDLException("SDL_GetWindowDisplayIndex");
+        ThrowSDLException("SDL_GetWindowDisplayIndex");
     return index;
 }
 
 void Window::DisplayMode(SDL_DisplayMode& mode) const
 {
     if (SDL_GetWindowDisplayMode(&*window_, &mode) != 0)
-        throw SDLException("SDL_GetWindowDisplayMode");
+        ThrowSDLException("SDL_GetWindowDisplayMode");
 }
 
 Uint32 Window::Flags() const
@@ -0,0 +1,100 @@
+// Packs every image under a directory into a baked atlas file, see
+// BakedAtlas.h. Sprites are named by their path relative to the directory
+// and added in name order, so the same directory always bakes the same file.
+//
+//     atlas-bake <input_dir> <output_file> [--page-size=N] [--padding=N]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "SDL2_image/include/SDL_image.h"
+
+#include "SDL2wrapper/include/BakedAtlas.h"
+#include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/SDL.h"
+#include "SDL2wrapper/include/SDLImage.h"
+#include "SDL2wrapper/include/Surface.h"
+
+#ifndef SDL2WRAPPER_IMAGE
+#error "atlas-bake loads images through SDL_image and needs SDL2WRAPPER_IMAGE"
+#endif
+
+namespace
+{
+
+int Usage(const char* argv0)
+{
+    std::fprintf(stderr, "usage: %s <input_dir> <output_file> [--page-size=N] [--padding=N]\n", argv0);
+    return 2;
+}
+
+bool ParseFlag(const std::string& arg, const std::string& name, int& value)
+{
+    const std::string prefix = "--" + name + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0)
+        return false;
+    value = std::atoi(arg.c_str() + prefix.size());
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+        return Usage(argv[0]);
+
+    const std::filesystem::path input = argv[1];
+    const std::string output = argv[2];
+    int page_size = 2048;
+    int padding = 1;
+    for (int i = 3; i < argc; ++i)
+    {
+        if (!ParseFlag(argv[i], "page-size", page_size) && !ParseFlag(argv[i], "padding", padding))
+            return Usage(argv[0]);
+    }
+    if (page_size <= 0 || padding < 0)
+        return Usage(argv[0]);
+
+    try
+    {
+        sdl2::SDL sdl(0);
+        sdl2::SDLImage image(IMG_INIT_PNG | IMG_INIT_JPG);
+
+        sdl2::AtlasBaker baker(page_size, page_size, padding);
+        // directory iteration order is unspecified
+        std::vector<std::string> names;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(input))
+        {
+            if (entry.is_regular_file())
+                names.push_back(entry.path().lexically_relative(input).generic_string());
+        }
+        std::sort(names.begin(), names.end());
+
+        for (const std::string& name : names)
+        {
+            try
+            {
+                baker.Add(name, sdl2::Surface((input / name).string()));
+            }
+            catch (const sdl2::SDLException& e)
+            {
+                std::fprintf(stderr, "skipping %s: %s\n", name.c_str(), e.what());
+            }
+        }
+
+        baker.Write(output);
+        std::printf("%s: %d sprites\n", output.c_str(), baker.Size());
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/AsyncReadback.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperAsyncReadbackTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperAsyncReadbackTest() :
+        SDL2wrapperSoftwareRendererTest(32, 32),
+        scene(CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 32, 32))
+    {}
+
+    // frame i is filled with blue i
+    void DrawFrame(Uint8 i)
+    {
+        renderer.Target(scene);
+        renderer.SetDrawColor(0, 0, i);
+        renderer.Clear();
+    }
+
+    struct Grab
+    {
+        Uint64 frame;
+        Uint32 pixel;
+    };
+
+    AsyncReadback::Consumer Recorder()
+    {
+        return [this](const ReadbackFrame& f) {
+            std::lock_guard<std::mutex> lock(mutex);
+            grabs.push_back(Grab{f.frame, static_cast<const Uint32*>(f.pixels)[0]});
+        };
+    }
+
+    // keeps the test independent of how fast the worker runs
+    void WaitForGrabs(size_t count)
+    {
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (grabs.size() >= count)
+                    return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    Texture scene;
+    std::mutex mutex;
+    std::vector<Grab> grabs;
+};
+
+TEST(SDL2wrapperIndexQueueTest, IsBoundedFifo)
+{
+    detail::IndexQueue queue(2);
+    int value = -1;
+    EXPECT_FALSE(queue.Pop(value));
+    EXPECT_TRUE(queue.Push(1));
+    EXPECT_TRUE(queue.Push(2));
+    EXPECT_FALSE(queue.Push(3));
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.Push(3));
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(value, 3);
+    EXPECT_FALSE(queue.Pop(value));
+}
+
+TEST(SDL2wrapperIndexQueueTest, PassesValuesBetweenThreads)
+{
+    detail::IndexQueue queue(4);
+    constexpr int kCount = 100000;
+    std::thread producer([&] {
+        for (int i = 0; i < kCount; ++i)
+            while (!queue.Push(i))
+                std::this_thread::yield();
+    });
+
+    int expected = 0;
+    while (expected < kCount)
+    {
+        int value;
+        if (!queue.Pop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(value, expected);
+        ++expected;
+    }
+    producer.join();
+}
+
+TEST_F(SDL2wrapperAsyncReadbackTest, FramesArriveLateAndInOrder)
+{
+    {
+        AsyncReadback readback(renderer, 32, 32, Recorder(), 3);
+        EXPECT_EQ(readback.Depth(), 3);
+
+        for (Uint8 i = 0; i < 3; ++i)
+        {
+            DrawFrame(i);
+            readback.Capture(scene);
+        }
+        // nothing read back until the ring wraps
+        EXPECT_EQ(readback.Captured(), 3u);
+
+        for (Uint8 i = 3; i < 8; ++i)
+        {
+            DrawFrame(i);
+            readback.Capture(scene);
+            WaitForGrabs(i - 2);
+        }
+        readback.Flush();
+        EXPECT_EQ(readback.Dropped(), 0u);
+    }
+
+    ASSERT_EQ(grabs.size(), 8u);
+    for (Uint64 i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(grabs[i].frame, i);
+        EXPECT_EQ(grabs[i].pixel, 0xFF000000u | static_cast<Uint32>(i));
+    }
+}
+
+TEST_F(SDL2wrapperAsyncReadbackTest, CaptureIgnoresBlendAndModulation)
+{
+    {
+        AsyncReadback readback(renderer, 32, 32, Recorder(), 1);
+        DrawFrame(200);
+        scene.BlendMode(SDL_BLENDMODE_BLEND).AlphaMod(0);
+        readback.Capture(scene).Flush();
+
+        EXPECT_EQ(scene.BlendMode(), SDL_BLENDMODE_BLEND);
+        EXPECT_EQ(scene.AlphaMod(), 0);
+    }
+
+    ASSERT_EQ(grabs.size(), 1u);
+    EXPECT_EQ(grabs[0].pixel, 0xFF0000C8u);
+}
+
+TEST_F(SDL2wrapperAsyncReadbackTest, SlowConsumerDropsFrames)
+{
+    std::atomic<bool> release{false};
+    std::atomic<int> delivered{0};
+    {
+        AsyncReadback readback(renderer, 32, 32, [&](const ReadbackFrame&) {
+            while (!release)
+                std::this_thread::yield();
+            ++delivered;
+        }, 2);
+
+        for (Uint8 i = 0; i < 10; ++i)
+        {
+            DrawFrame(i);
+            readback.Capture(scene);
+        }
+        EXPECT_GT(readback.Dropped(), 0u);
+        release = true;
+    }
+
+    EXPECT_EQ(delivered, 2);
+}
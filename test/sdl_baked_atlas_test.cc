@@ -0,0 +1,144 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/BakedAtlas.h"
+#include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/TextureAtlas.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperBakedAtlasTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperBakedAtlasTest() :
+        SDL2wrapperSoftwareRendererTest(256, 256),
+        path(::testing::TempDir() + "sdl_baked_atlas_test.atlas")
+    {}
+
+    ~SDL2wrapperBakedAtlasTest() override
+    {
+        std::remove(path.c_str());
+    }
+
+    // rewrites the file with the first page record changed by edit
+    template <typename Edit>
+    void EditFirstPage(Edit edit)
+    {
+        std::vector<char> bytes;
+        {
+            std::ifstream in(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        ASSERT_GE(bytes.size(), sizeof(detail::AtlasHeader) + sizeof(detail::AtlasPage));
+        detail::AtlasPage page;
+        std::memcpy(&page, bytes.data() + sizeof(detail::AtlasHeader), sizeof(page));
+        edit(page);
+        std::memcpy(bytes.data() + sizeof(detail::AtlasHeader), &page, sizeof(page));
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::string path;
+};
+
+TEST_F(SDL2wrapperBakedAtlasTest, RoundTrip)
+{
+    AtlasBaker baker(64, 64);
+    baker.Add("ui/red.png", Sprite(16, 16, 0xFFFF0000));
+    baker.Add("ui/green.png", Sprite(8, 24, 0xFF00FF00));
+    baker.Add("blue.png", Sprite(40, 40, 0xFF0000FF));
+    baker.Write(path);
+
+    BakedAtlas atlas(renderer, path);
+    EXPECT_EQ(atlas.Size(), 3);
+    EXPECT_EQ(atlas.PageCount(), 1);
+    EXPECT_EQ(atlas.Name(0), "blue.png");
+    EXPECT_EQ(atlas.Name(2), "ui/red.png");
+
+    std::optional<TextureAtlas::Region> red = atlas.Find("ui/red.png");
+    std::optional<TextureAtlas::Region> green = atlas.Find("ui/green.png");
+    ASSERT_TRUE(red);
+    ASSERT_TRUE(green);
+    EXPECT_EQ(red->rect.w, 16);
+    EXPECT_EQ(green->rect.h, 24);
+    EXPECT_FALSE(atlas.Find("ui/missing.png"));
+    EXPECT_FALSE(atlas.Find(""));
+
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.Copy(atlas.Page(*red), red->rect, Rect(0, 0, 16, 16));
+    renderer.Copy(atlas.Page(*green), green->rect, Rect(32, 0, 8, 24));
+
+    EXPECT_EQ(Pixel(8, 8), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(35, 20), 0xFF00FF00u);
+    EXPECT_EQ(Pixel(20, 8), 0xFF000000u);
+}
+
+TEST_F(SDL2wrapperBakedAtlasTest, SpillsToNewPages)
+{
+    AtlasBaker baker(32, 32, 0);
+    for (int i = 0; i < 5; ++i)
+        baker.Add("sprite" + std::to_string(i), Sprite(32, 32, 0xFFFFFFFF));
+    baker.Write(path);
+
+    BakedAtlas atlas(renderer, path);
+    EXPECT_EQ(atlas.PageCount(), 5);
+    for (int i = 0; i < atlas.Size(); ++i)
+        EXPECT_EQ(atlas.Region(i).rect, Rect(0, 0, 32, 32));
+}
+
+TEST_F(SDL2wrapperBakedAtlasTest, RejectsBadFiles)
+{
+    SDL_RWops* rw = SDL_RWFromFile(path.c_str(), "wb");
+    ASSERT_NE(rw, nullptr);
+    SDL_RWwrite(rw, "not an atlas at all, just some text", 35, 1);
+    SDL_RWclose(rw);
+
+    EXPECT_THROW(BakedAtlas(renderer, path), SDLException);
+    EXPECT_THROW(BakedAtlas(renderer, path + ".missing"), SDLException);
+
+    AtlasBaker baker(32, 32);
+    baker.Add("red.png", Sprite(16, 16, 0xFFFF0000));
+
+    // rows shorter than the page is wide
+    baker.Write(path);
+    EditFirstPage([](detail::AtlasPage& page) { page.pitch = page.width * 4 - 1; });
+    EXPECT_THROW(BakedAtlas(renderer, path), SDLException);
+
+    // offset + pitch * height wraps around
+    baker.Write(path);
+    EditFirstPage([](detail::AtlasPage& page) { page.offset = ~Uint64(0) - 16; });
+    EXPECT_THROW(BakedAtlas(renderer, path), SDLException);
+
+    // pixels run past the end of the file
+    baker.Write(path);
+    EditFirstPage([](detail::AtlasPage& page) { page.height = 0x7FFFFFFF; });
+    EXPECT_THROW(BakedAtlas(renderer, path), SDLException);
+
+    // the header names a format the pages are not in
+    baker.Write(path);
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const Uint32 format = SDL_PIXELFORMAT_RGB565;
+        file.seekp(offsetof(detail::AtlasHeader, format));
+        file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+    }
+    EXPECT_THROW(BakedAtlas(renderer, path), SDLException);
+
+    baker.Write(path);
+    EXPECT_NO_THROW(BakedAtlas(renderer, path));
+}
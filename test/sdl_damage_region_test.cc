@@ -0,0 +1,106 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/DamageRegion.h"
+#include "SDL2wrapper/include/Rect.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+void ExpectDisjoint(const std::vector<Rect>& rects)
+{
+    for (std::size_t i = 0; i < rects.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < rects.size(); ++j)
+            EXPECT_FALSE(rects[i].Intersects(rects[j])) << rects[i] << " " << rects[j];
+    }
+}
+
+bool Covered(const DamageRegion& region, int x, int y)
+{
+    for (const Rect& r : region.Rects())
+    {
+        if (r.Contains(Point(x, y)))
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+TEST(SDL2wrapperDamageRegionTest, IgnoresEmptyRects)
+{
+    DamageRegion region;
+    region.Add(Rect(10, 10, 0, 5)).Add(Rect(10, 10, 5, -1));
+    EXPECT_TRUE(region.Empty());
+    EXPECT_EQ(region.Bounds(), Rect());
+}
+
+TEST(SDL2wrapperDamageRegionTest, KeepsDistantRectsApart)
+{
+    DamageRegion region;
+    region.Add(Rect(0, 0, 10, 10)).Add(Rect(100, 100, 10, 10));
+    ASSERT_EQ(region.Rects().size(), 2u);
+    EXPECT_EQ(region.Area(), 200);
+    EXPECT_EQ(region.Bounds(), Rect(0, 0, 110, 110));
+    EXPECT_TRUE(region.Intersects(Rect(105, 0, 10, 200)));
+    EXPECT_FALSE(region.Intersects(Rect(20, 20, 50, 50)));
+}
+
+TEST(SDL2wrapperDamageRegionTest, MergesOverlapsAndNeighbours)
+{
+    DamageRegion region;
+    region.Add(Rect(0, 0, 10, 10)).Add(Rect(5, 5, 10, 10));
+    ASSERT_EQ(region.Rects().size(), 1u);
+    EXPECT_EQ(region.Rects()[0], Rect(0, 0, 15, 15));
+
+    // touching and aligned: the union wastes nothing
+    region.Clear().Add(Rect(0, 0, 10, 10)).Add(Rect(10, 0, 10, 10));
+    ASSERT_EQ(region.Rects().size(), 1u);
+    EXPECT_EQ(region.Rects()[0], Rect(0, 0, 20, 10));
+
+    // contained rects change nothing
+    region.Add(Rect(2, 2, 3, 3));
+    EXPECT_EQ(region.Rects().size(), 1u);
+}
+
+TEST(SDL2wrapperDamageRegionTest, MergeReachesNewNeighbours)
+{
+    DamageRegion region;
+    region.Add(Rect(0, 0, 10, 10)).Add(Rect(40, 0, 10, 10));
+    ASSERT_EQ(region.Rects().size(), 2u);
+
+    // bridges both
+    region.Add(Rect(5, 0, 40, 10));
+    ASSERT_EQ(region.Rects().size(), 1u);
+    EXPECT_EQ(region.Rects()[0], Rect(0, 0, 50, 10));
+}
+
+TEST(SDL2wrapperDamageRegionTest, StaysWithinMaxRects)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> position(0, 1000);
+    std::uniform_int_distribution<int> size(1, 40);
+
+    DamageRegion region(4);
+    std::vector<Rect> added;
+    for (int i = 0; i < 200; ++i)
+    {
+        Rect r(position(random), position(random), size(random), size(random));
+        added.push_back(r);
+        region.Add(r);
+        EXPECT_LE(static_cast<int>(region.Rects().size()), 4);
+        ExpectDisjoint(region.Rects());
+    }
+
+    for (const Rect& r : added)
+    {
+        EXPECT_TRUE(Covered(region, r.x, r.y)) << r;
+        EXPECT_TRUE(Covered(region, r.X2(), r.Y2())) << r;
+    }
+}
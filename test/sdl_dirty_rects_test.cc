@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/DamageRegion.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperDirtyRectsTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperDirtyRectsTest()
+    {
+        renderer.SetDrawColor(0, 0, 0);
+        renderer.Clear();
+        renderer.Present();
+    }
+};
+
+TEST_F(SDL2wrapperDirtyRectsTest, FirstFrameIsFullyDamaged)
+{
+    renderer.DirtyRects(true);
+    EXPECT_TRUE(renderer.DirtyRects());
+    EXPECT_EQ(renderer.Damage().Bounds(), Rect(0, 0, 64, 64));
+
+    renderer.Present();
+    EXPECT_TRUE(renderer.Damage().Empty());
+}
+
+TEST_F(SDL2wrapperDirtyRectsTest, DrawingIsClippedToDamage)
+{
+    renderer.DirtyRects(true).Present();
+
+    renderer.Invalidate(Rect(8, 8, 8, 8));
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.FillRect(Rect(0, 0, 64, 64));
+    renderer.Present();
+
+    EXPECT_EQ(Pixel(10, 10), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(15, 15), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(16, 16), 0xFF000000u);
+    EXPECT_EQ(Pixel(40, 40), 0xFF000000u);
+}
+
+TEST_F(SDL2wrapperDirtyRectsTest, ClearOnlyTouchesDamage)
+{
+    renderer.SetDrawColor(0, 0, 255);
+    renderer.Clear();
+    renderer.DirtyRects(true).Present();
+
+    renderer.Invalidate(Rect(0, 0, 4, 4)).Invalidate(Rect(32, 32, 4, 4));
+    renderer.SetDrawColor(0, 255, 0, 128);
+    renderer.DrawBlendMode(SDL_BLENDMODE_BLEND);
+    renderer.Clear();
+    renderer.Present();
+
+    // cleared without blending, like SDL_RenderClear
+    EXPECT_EQ(Pixel(1, 1), 0x8000FF00u);
+    EXPECT_EQ(Pixel(33, 33), 0x8000FF00u);
+    EXPECT_EQ(Pixel(16, 16), 0xFF0000FFu);
+    EXPECT_EQ(renderer.BlendMode(), SDL_BLENDMODE_BLEND);
+}
+
+TEST_F(SDL2wrapperDirtyRectsTest, BlendedDrawsAreNotDoubled)
+{
+    renderer.DirtyRects(true).Present();
+
+    // two overlapping invalidations merge, so the overlap is drawn once
+    renderer.Invalidate(Rect(0, 0, 16, 16)).Invalidate(Rect(8, 8, 16, 16));
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.SetDrawColor(255, 255, 255, 128);
+    renderer.DrawBlendMode(SDL_BLENDMODE_BLEND);
+    renderer.FillRect(Rect(0, 0, 64, 64));
+    renderer.Present();
+
+    EXPECT_EQ(Pixel(4, 4), Pixel(12, 12));
+    EXPECT_EQ(Pixel(40, 40), 0xFF000000u);
+}
+
+TEST_F(SDL2wrapperDirtyRectsTest, KeepsUserClipRect)
+{
+    renderer.ClipRect(Rect(0, 0, 10, 10));
+    renderer.DirtyRects(true).Present();
+
+    renderer.Invalidate(Rect(5, 5, 20, 20));
+    EXPECT_EQ(renderer.ClipRect(), Rect(0, 0, 10, 10));
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.FillRect(Rect(0, 0, 64, 64));
+    renderer.Present();
+
+    EXPECT_EQ(Pixel(7, 7), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(12, 12), 0xFF000000u);
+    EXPECT_EQ(Pixel(2, 2), 0xFF000000u);
+
+    renderer.DirtyRects(false);
+    renderer.FillRect(Rect(0, 0, 64, 64));
+    EXPECT_EQ(Pixel(2, 2), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(12, 12), 0xFF000000u);
+}
+
+TEST_F(SDL2wrapperDirtyRectsTest, DeferredDrawsAreClipped)
+{
+    renderer.DirtyRects(true).Present();
+    renderer.Deferred(true);
+
+    renderer.Invalidate(Rect(0, 0, 8, 8)).Invalidate(Rect(32, 0, 8, 8));
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.FillRect(Rect(0, 0, 64, 4));
+    renderer.FillRect(Rect(0, 4, 64, 4));
+    renderer.Present();
+
+    EXPECT_EQ(Pixel(2, 2), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(34, 6), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(20, 2), 0xFF000000u);
+}
@@ -0,0 +1,96 @@
+#include "benchmark/benchmark.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/SDL2wrapper.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+constexpr int kTargetWidth = 3840;
+constexpr int kTargetHeight = 2160;
+
+// FillCopy as it was before batching: one SDL_RenderCopy per tile
+void PerTileFillCopy(Renderer& renderer, Texture& texture, const Rect& dst)
+{
+    Point size = texture.Size();
+    for (int y = 0; y < dst.h; y += size.y)
+    {
+        for (int x = 0; x < dst.w; x += size.x)
+        {
+            Rect tile_src(0, 0, size.x, size.y);
+            Rect tile_dst(x, y, size.x, size.y);
+
+            int xoverflow = tile_dst.x + tile_dst.w - dst.w;
+            if (xoverflow > 0) {
+                tile_src.w -= xoverflow;
+                tile_dst.w -= xoverflow;
+            }
+
+            int yoverflow = tile_dst.y + tile_dst.h - dst.h;
+            if (yoverflow > 0) {
+                tile_src.h -= yoverflow;
+                tile_dst.h -= yoverflow;
+            }
+
+            renderer.Copy(texture, tile_src, tile_dst + dst.TopLeft());
+        }
+    }
+}
+
+Surface MakeTarget()
+{
+    return Surface(0, kTargetWidth, kTargetHeight, 32,
+        0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+}
+
+int TileCount(int tile)
+{
+    return ((kTargetWidth + tile - 1) / tile) * ((kTargetHeight + tile - 1) / tile);
+}
+
+} // namespace
+
+static void BM_FillCopyPerTile(benchmark::State& state)
+{
+    const int tile = static_cast<int>(state.range(0));
+    Surface target = MakeTarget();
+    Renderer renderer(SDL_CreateSoftwareRenderer(target.Get()));
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, tile, tile);
+
+    for (auto _ : state)
+        PerTileFillCopy(renderer, texture, Rect(0, 0, kTargetWidth, kTargetHeight));
+
+    state.SetItemsProcessed(state.iterations() * TileCount(tile));
+}
+BENCHMARK(BM_FillCopyPerTile)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_FillCopyBatched(benchmark::State& state)
+{
+    const int tile = static_cast<int>(state.range(0));
+    Surface target = MakeTarget();
+    Renderer renderer(SDL_CreateSoftwareRenderer(target.Get()));
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, tile, tile);
+
+    for (auto _ : state)
+        renderer.FillCopy(texture, std::nullopt, Rect(0, 0, kTargetWidth, kTargetHeight));
+
+    state.SetItemsProcessed(state.iterations() * TileCount(tile));
+}
+BENCHMARK(BM_FillCopyBatched)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_FillCopyBatchedFlipped(benchmark::State& state)
+{
+    const int tile = static_cast<int>(state.range(0));
+    Surface target = MakeTarget();
+    Renderer renderer(SDL_CreateSoftwareRenderer(target.Get()));
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, tile, tile);
+
+    for (auto _ : state)
+        renderer.FillCopy(texture, std::nullopt, Rect(0, 0, kTargetWidth, kTargetHeight),
+            Point(tile / 2, tile / 2), SDL_FLIP_HORIZONTAL);
+
+    state.SetItemsProcessed(state.iterations() * TileCount(tile));
+}
+BENCHMARK(BM_FillCopyBatchedFlipped)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
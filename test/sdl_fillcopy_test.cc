@@ -0,0 +1,159 @@
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+constexpr int kTextureWidth = 5;
+constexpr int kTextureHeight = 3;
+constexpr int kTargetSize = 40;
+
+// FillCopy as it was before batching: one CopyEx per tile
+void PerTileFillCopy(Renderer& renderer, Texture& texture, const Rect& dst, const Point& offset, int flip)
+{
+    Rect src(Point(0, 0), texture.Size());
+    Rect start_tile(offset.x, offset.y, src.w, src.h);
+
+    if (start_tile.x + start_tile.w <= 0)
+        start_tile.x += (-start_tile.x) / start_tile.w * start_tile.w;
+    if (start_tile.x > 0)
+        start_tile.x -= (start_tile.x + start_tile.w - 1) / start_tile.w * start_tile.w;
+
+    if (start_tile.y + start_tile.h <= 0)
+        start_tile.y += (-start_tile.y) / start_tile.h * start_tile.h;
+    if (start_tile.y > 0)
+        start_tile.y -= (start_tile.y + start_tile.h - 1) / start_tile.h * start_tile.h;
+
+    for (int y = start_tile.y; y < dst.h; y += start_tile.h)
+    {
+        for (int x = start_tile.x; x < dst.w; x += start_tile.w)
+        {
+            Rect tile_src = src;
+            Rect tile_dst(x, y, start_tile.w, start_tile.h);
+
+            if (x < 0) {
+                tile_src.x -= x;
+                tile_src.w += x;
+                tile_dst.x -= x;
+                tile_dst.w += x;
+            }
+            if (y < 0) {
+                tile_src.y -= y;
+                tile_src.h += y;
+                tile_dst.y -= y;
+                tile_dst.h += y;
+            }
+
+            int xoverflow = tile_dst.x + tile_dst.w - dst.w;
+            if (xoverflow > 0) {
+                tile_src.w -= xoverflow;
+                tile_dst.w -= xoverflow;
+            }
+            int yoverflow = tile_dst.y + tile_dst.h - dst.h;
+            if (yoverflow > 0) {
+                tile_src.h -= yoverflow;
+                tile_dst.h -= yoverflow;
+            }
+
+            if (flip & SDL_FLIP_HORIZONTAL)
+                tile_src.x = src.w - tile_src.x - tile_src.w;
+            if (flip & SDL_FLIP_VERTICAL)
+                tile_src.y = src.h - tile_src.y - tile_src.h;
+
+            renderer.Copy(texture, tile_src, tile_dst + dst.TopLeft(), 0.0, std::nullopt, flip);
+        }
+    }
+}
+
+// a texture whose every texel differs, on its own target
+struct Canvas : SDL2wrapperSoftwareRenderer
+{
+    Canvas() :
+        SDL2wrapperSoftwareRenderer(kTargetSize, kTargetSize),
+        texture(CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+            kTextureWidth, kTextureHeight))
+    {
+        std::vector<Uint32> texels(kTextureWidth * kTextureHeight);
+        for (int i = 0; i < static_cast<int>(texels.size()); ++i)
+            texels[i] = 0xFF000000u | static_cast<Uint32>(i + 1) * 0x0F0B07u;
+        texture.Update(std::nullopt, texels.data(), kTextureWidth * 4);
+        texture.BlendMode(SDL_BLENDMODE_NONE);
+
+        renderer.SetDrawColor(0, 0, 0);
+        renderer.Clear();
+    }
+
+    std::vector<Uint32> Pixels()
+    {
+        Surface::LockHandle lock = target.Lock();
+        const Uint8* pixels = static_cast<const Uint8*>(lock.Pixels());
+        std::vector<Uint32> result;
+        for (int y = 0; y < kTargetSize; ++y)
+        {
+            const Uint32* row = reinterpret_cast<const Uint32*>(pixels + y * lock.Pitch());
+            result.insert(result.end(), row, row + kTargetSize);
+        }
+        return result;
+    }
+
+    Texture texture;
+};
+
+} // namespace
+
+// FillCopy with a non-zero offset and each flip against per-tile CopyEx
+class SDL2wrapperFillCopyTest : public ::testing::TestWithParam<int>
+{
+};
+
+TEST_P(SDL2wrapperFillCopyTest, MatchesPerTileCopies)
+{
+    const int flip = GetParam();
+    const Rect dst(3, 2, 23, 17);
+    for (const Point& offset : {Point(0, 0), Point(2, -1), Point(-7, 4), Point(13, 8)})
+    {
+        Canvas batched;
+        batched.renderer.FillCopy(batched.texture, std::nullopt, dst, offset, flip);
+
+        Canvas reference;
+        PerTileFillCopy(reference.renderer, reference.texture, dst, offset, flip);
+
+        std::vector<Uint32> got = batched.Pixels();
+        std::vector<Uint32> want = reference.Pixels();
+        for (int i = 0; i < kTargetSize * kTargetSize; ++i)
+        {
+            ASSERT_EQ(got[i], want[i]) << "at (" << i % kTargetSize << ", " << i / kTargetSize
+                << ") offset " << offset;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Flip, SDL2wrapperFillCopyTest,
+    ::testing::Values(SDL_FLIP_NONE, SDL_FLIP_HORIZONTAL, SDL_FLIP_VERTICAL,
+        SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL),
+    [](const ::testing::TestParamInfo<int>& info) {
+        switch (info.param)
+        {
+        case SDL_FLIP_NONE:
+            return "None";
+        case SDL_FLIP_HORIZONTAL:
+            return "Horizontal";
+        case SDL_FLIP_VERTICAL:
+            return "Vertical";
+        default:
+            return "Both";
+        }
+    });
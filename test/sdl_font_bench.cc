@@ -0,0 +1,197 @@
+#include <cstdlib>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "libs/SDL2/include/SDL.h"
+#include "libs/SDL2_ttf/include/SDL_ttf.h"
+
+#include "SDL2wrapper/include/SDL2wrapper.h"
+
+using namespace sdl2;
+
+// Font measurement and rendering. Every benchmark reports glyphs/s.
+//
+// BM_FontSteady reuses one font whose glyph cache was warmed by an untimed
+// call; BM_FontFirstCall opens a fresh font for every iteration, outside
+// the timing, and times its first call, which loads and rasterizes every
+// distinct glyph. The difference between the two is the cache.
+//
+// SDL2WRAPPER_FONT_PATH overrides the font, default test/testdata/Vera.ttf.
+
+namespace
+{
+
+constexpr int kPointSize = 16;
+
+enum Op
+{
+    kSolid,
+    kShaded,
+    kBlended,
+    kSize,
+};
+
+const char* const kOpNames[] = {"solid", "shaded", "blended", "size"};
+
+enum Encoding
+{
+    kUTF8,
+    kUTF16,
+};
+
+// bits of the options argument
+enum Option
+{
+    kKerning = 1,
+    kNoHinting = 2,
+    kOutline = 4,
+};
+
+constexpr int kLengths[] = {1, 16, 256, 4096};
+
+const SDL_Color kForeground = {255, 255, 255, 255};
+const SDL_Color kBackground = {0, 0, 64, 255};
+
+std::string FontPath()
+{
+    const char* path = std::getenv("SDL2WRAPPER_FONT_PATH");
+    return path == nullptr ? "test/testdata/Vera.ttf" : path;
+}
+
+void InitTTF()
+{
+    static SDLTTF* ttf = new SDLTTF();
+    (void)ttf;
+}
+
+Font OpenFont(int options)
+{
+    Font font(FontPath(), kPointSize);
+    font.Kerning((options & kKerning) != 0);
+    font.Hinting((options & kNoHinting) != 0 ? TTF_HINTING_NONE : TTF_HINTING_NORMAL);
+    font.Outline((options & kOutline) != 0 ? 1 : 0);
+    return font;
+}
+
+// ASCII only, so every char and every UTF-16 unit is one glyph
+struct Text
+{
+    explicit Text(int length)
+    {
+        const char pangram[] = "The quick brown fox jumps over the lazy dog. 0123456789 ";
+        for (int i = 0; i < length; ++i)
+        {
+            utf8.push_back(pangram[i % (sizeof(pangram) - 1)]);
+            utf16.push_back(static_cast<char16_t>(utf8.back()));
+        }
+    }
+
+    std::string utf8;
+    std::u16string utf16;
+};
+
+// width of the result, so the call cannot be dropped
+int Run(Font& font, Op op, Encoding encoding, const Text& text)
+{
+    const bool utf8 = encoding == kUTF8;
+    switch (op)
+    {
+    case kSolid:
+        return (utf8 ? font.RenderUTF8_Solid(text.utf8, kForeground)
+                     : font.RenderUNICODE_Solid(text.utf16, kForeground)).Width();
+    case kShaded:
+        return (utf8 ? font.RenderUTF8_Shaded(text.utf8, kForeground, kBackground)
+                     : font.RenderUNICODE_Shaded(text.utf16, kForeground, kBackground)).Width();
+    case kBlended:
+        return (utf8 ? font.RenderUTF8_Blended(text.utf8, kForeground)
+                     : font.RenderUNICODE_Blended(text.utf16, kForeground)).Width();
+    default:
+        return (utf8 ? font.SizeOfUTF8(text.utf8) : font.SizeOfUnicode(text.utf16)).x;
+    }
+}
+
+void Label(benchmark::State& state, Op op, Encoding encoding, int options)
+{
+    std::string label = kOpNames[op];
+    label += encoding == kUTF8 ? " utf8" : " utf16";
+    if ((options & kKerning) != 0)
+        label += " kerning";
+    if ((options & kNoHinting) != 0)
+        label += " unhinted";
+    if ((options & kOutline) != 0)
+        label += " outline";
+    state.SetLabel(label.c_str());
+}
+
+void SetGlyphCounter(benchmark::State& state, int glyphs_per_iteration)
+{
+    state.counters["glyphs/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * glyphs_per_iteration),
+        benchmark::Counter::kIsRate
+    );
+}
+
+// every op and encoding over the lengths with default options, and every
+// option combination at 256 glyphs
+void FontArgs(benchmark::internal::Benchmark* bench)
+{
+    for (int op = kSolid; op <= kSize; ++op)
+    {
+        for (int encoding = kUTF8; encoding <= kUTF16; ++encoding)
+            for (int length : kLengths)
+                bench->Args({op, encoding, length, 0});
+        for (int options = 1; options < 8; ++options)
+            bench->Args({op, kUTF8, 256, options});
+    }
+}
+
+} // namespace
+
+// args: op, encoding, length, options
+static void BM_FontSteady(benchmark::State& state)
+{
+    const Op op = static_cast<Op>(state.range(0));
+    const Encoding encoding = static_cast<Encoding>(state.range(1));
+    const int length = static_cast<int>(state.range(2));
+    const int options = static_cast<int>(state.range(3));
+
+    InitTTF();
+    Font font = OpenFont(options);
+    const Text text(length);
+    Label(state, op, encoding, options);
+    Run(font, op, encoding, text);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Run(font, op, encoding, text));
+
+    SetGlyphCounter(state, length);
+}
+BENCHMARK(BM_FontSteady)->Apply(FontArgs);
+
+// args: op, encoding, length, options
+static void BM_FontFirstCall(benchmark::State& state)
+{
+    const Op op = static_cast<Op>(state.range(0));
+    const Encoding encoding = static_cast<Encoding>(state.range(1));
+    const int length = static_cast<int>(state.range(2));
+    const int options = static_cast<int>(state.range(3));
+
+    InitTTF();
+    const Text text(length);
+    Label(state, op, encoding, options);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        {
+            Font font = OpenFont(options);
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(Run(font, op, encoding, text));
+            state.PauseTiming();
+        }
+        state.ResumeTiming();
+    }
+
+    SetGlyphCounter(state, length);
+}
+BENCHMARK(BM_FontFirstCall)->Apply(FontArgs);
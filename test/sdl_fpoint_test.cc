@@ -0,0 +1,52 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/Point.h"
+
+using namespace sdl2;
+
+TEST(SDL2wrapperFPointTest, Constructors)
+{
+    constexpr FPoint p;
+    static_assert(p.x == 0.0f && p.y == 0.0f);
+
+    constexpr FPoint a(1.5f, -2.5f);
+    EXPECT_EQ(a.x, 1.5f);
+    EXPECT_EQ(a.y, -2.5f);
+
+    SDL_FPoint sdl_point = {3.0f, 4.0f};
+    FPoint b(sdl_point);
+    EXPECT_EQ(b, FPoint(3.0f, 4.0f));
+
+    constexpr FPoint c(Point(5, 6));
+    EXPECT_EQ(c, FPoint(5.0f, 6.0f));
+}
+
+TEST(SDL2wrapperFPointTest, Arithmetic)
+{
+    constexpr FPoint a(1.5f, 2.0f);
+    constexpr FPoint b(0.5f, 1.0f);
+
+    static_assert(a + b == FPoint(2.0f, 3.0f));
+    static_assert(a - b == FPoint(1.0f, 1.0f));
+    static_assert(-a == FPoint(-1.5f, -2.0f));
+    static_assert(a * 2.0f == FPoint(3.0f, 4.0f));
+    static_assert(a / 2.0f == FPoint(0.75f, 1.0f));
+    static_assert(a != b);
+
+    FPoint c = a;
+    c += b;
+    EXPECT_EQ(c, FPoint(2.0f, 3.0f));
+    c -= b;
+    EXPECT_EQ(c, a);
+}
+
+TEST(SDL2wrapperFPointTest, Stream)
+{
+    std::ostringstream os;
+    os << FPoint(1.5f, 2.0f);
+    EXPECT_EQ(os.str(), "[ x:1.5; y: 2]");
+}
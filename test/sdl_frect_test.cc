@@ -0,0 +1,107 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Rect.h"
+
+using namespace sdl2;
+
+TEST(SDL2wrapperFRectTest, Constructors)
+{
+    constexpr FRect r;
+    static_assert(r.x == 0.0f && r.y == 0.0f && r.w == 0.0f && r.h == 0.0f);
+
+    constexpr FRect a(FPoint(1.0f, 2.0f), FPoint(3.0f, 4.0f));
+    static_assert(a == FRect(1.0f, 2.0f, 3.0f, 4.0f));
+
+    constexpr FRect b(Rect(1, 2, 3, 4));
+    static_assert(a == b);
+
+    SDL_FRect sdl_rect = {0.5f, 0.5f, 1.0f, 1.0f};
+    EXPECT_EQ(FRect(sdl_rect), FRect(0.5f, 0.5f, 1.0f, 1.0f));
+}
+
+TEST(SDL2wrapperFRectTest, FactoriesAndEdges)
+{
+    constexpr FRect a = FRect::FromCorners(1.0f, 2.0f, 4.0f, 6.0f);
+    static_assert(a == FRect(1.0f, 2.0f, 3.0f, 4.0f));
+    static_assert(a.X2() == 4.0f && a.Y2() == 6.0f);
+    static_assert(a.BottomRight() == FPoint(4.0f, 6.0f));
+    static_assert(a.Center() == FPoint(2.5f, 4.0f));
+
+    static_assert(FRect::FromCorners(FPoint(1.0f, 2.0f), FPoint(4.0f, 6.0f)) == a);
+    static_assert(FRect::FromCenter(FPoint(2.5f, 4.0f), 3.0f, 4.0f) == a);
+    static_assert(FRect::FromCenter(FPoint(2.5f, 4.0f), FPoint(3.0f, 4.0f)) == a);
+
+    FRect b = a;
+    b.X2(5.0f).Y2(8.0f);
+    EXPECT_EQ(b, FRect(1.0f, 2.0f, 4.0f, 6.0f));
+}
+
+TEST(SDL2wrapperFRectTest, ContainsAndIntersects)
+{
+    constexpr FRect a(0.0f, 0.0f, 2.0f, 2.0f);
+
+    static_assert(a.Contains(FPoint(0.0f, 0.0f)));
+    static_assert(a.Contains(1.99f, 1.99f));
+    static_assert(!a.Contains(FPoint(2.0f, 1.0f)));
+    static_assert(a.Contains(FRect(0.5f, 0.5f, 1.5f, 1.5f)));
+
+    // touching edges do not intersect, like SDL_HasIntersectionF
+    static_assert(!a.Intersects(FRect(2.0f, 0.0f, 1.0f, 1.0f)));
+    static_assert(a.Intersects(FRect(1.5f, 1.5f, 1.0f, 1.0f)));
+
+    auto intersection = a.GetIntersection(FRect(1.5f, 1.0f, 1.0f, 4.0f));
+    ASSERT_TRUE(intersection);
+    EXPECT_EQ(*intersection, FRect(1.5f, 1.0f, 0.5f, 1.0f));
+    EXPECT_FALSE(a.GetIntersection(FRect(3.0f, 3.0f, 1.0f, 1.0f)));
+
+    EXPECT_EQ(a.Union(FRect(3.0f, 1.0f, 1.0f, 2.0f)), FRect(0.0f, 0.0f, 4.0f, 3.0f));
+}
+
+TEST(SDL2wrapperFRectTest, ExtendAndOffset)
+{
+    FRect a(1.0f, 1.0f, 2.0f, 2.0f);
+
+    EXPECT_EQ(a.Extension(0.5f), FRect(0.5f, 0.5f, 3.0f, 3.0f));
+    EXPECT_EQ(a.Extension(1.0f, 0.0f), FRect(0.0f, 1.0f, 4.0f, 2.0f));
+    EXPECT_EQ(a + FPoint(1.0f, 2.0f), FRect(2.0f, 3.0f, 2.0f, 2.0f));
+
+    a += FPoint(0.5f, 0.5f);
+    EXPECT_EQ(a, FRect(1.5f, 1.5f, 2.0f, 2.0f));
+    a -= FPoint(0.5f, 0.5f);
+    EXPECT_EQ(a, FRect(1.0f, 1.0f, 2.0f, 2.0f));
+}
+
+TEST(SDL2wrapperFRectTest, Enclosing)
+{
+    EXPECT_EQ(FRect(0.5f, 0.5f, 1.0f, 1.0f).Enclosing(), Rect(0, 0, 2, 2));
+    EXPECT_EQ(FRect(-1.5f, 2.0f, 3.0f, 1.0f).Enclosing(), Rect(-2, 2, 4, 1));
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 22)
+TEST(SDL2wrapperFRectTest, IntersectsLine)
+{
+    FRect a(0.0f, 0.0f, 10.0f, 10.0f);
+    FPoint p1(-5.0f, 5.0f);
+    FPoint p2(15.0f, 5.0f);
+
+    EXPECT_TRUE(a.IntersectsLine(p1, p2));
+    EXPECT_EQ(p1.x, 0.0f);
+    EXPECT_EQ(p1.y, 5.0f);
+
+    FPoint q1(-5.0f, -5.0f);
+    FPoint q2(-1.0f, -1.0f);
+    EXPECT_FALSE(a.IntersectsLine(q1, q2));
+}
+#endif
+
+TEST(SDL2wrapperFRectTest, Stream)
+{
+    std::ostringstream os;
+    os << FRect(1.5f, 2.0f, 3.0f, 4.0f);
+    EXPECT_EQ(os.str(), "[ x:1.5; y:2; w:3; h:4 ]");
+}
@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/SDL2wrapper.h"
+
+using namespace sdl2;
+
+// Renders scenes with the software renderer on a window of the dummy video
+// driver, so no display or GPU is needed, and compares them to BMP goldens
+// in testdata/golden. Only RGB is compared; window surfaces have no alpha.
+// Goldens are always recorded from SDL's own output; a scene without one is
+// only timed, and its frame is saved so it can be reviewed and committed.
+//
+// SDL2WRAPPER_GOLDEN_DIR      where goldens are read from
+// SDL2WRAPPER_UPDATE_GOLDENS  directory to write fresh goldens to instead
+//                             of comparing
+// SDL2WRAPPER_TIME_SCALE      multiplies every time budget, default 1
+//
+// Every scene is also timed; the median frame must stay inside the scene's
+// budget. Failed frames are written to TEST_UNDECLARED_OUTPUTS_DIR.
+
+// Outside the anonymous namespace: Scene is the fixture's parameter.
+struct Assets
+{
+    // 4x4 with 2x2 red and yellow checks
+    Texture checker;
+    // 8x8, left half blue and right half white
+    Texture sprite;
+};
+
+struct Scene
+{
+    const char* name;
+    int w;
+    int h;
+    // false for scenes that are only timed
+    bool golden;
+    double budget_ms;
+    void (*draw)(Renderer& renderer, Assets& assets);
+};
+
+namespace
+{
+
+constexpr int kChannelTolerance = 2;
+constexpr double kMismatchTolerance = 0.01;
+constexpr int kTimedFrames = 21;
+
+Texture MakeTexture(Renderer& renderer, int w, int h, Uint32 (*texel)(int x, int y))
+{
+    std::vector<Uint32> pixels(w * h);
+    for (int y = 0; y < h; ++y)
+        for (int x = 0; x < w; ++x)
+            pixels[y * w + x] = texel(x, y);
+
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, w, h);
+    texture.Update(std::nullopt, pixels.data(), w * 4);
+    return texture;
+}
+
+Assets MakeAssets(Renderer& renderer)
+{
+    return Assets{
+        MakeTexture(renderer, 4, 4, [](int x, int y) {
+            return ((x < 2) != (y < 2)) ? 0xFFFFFF00u : 0xFFFF0000u;
+        }),
+        MakeTexture(renderer, 8, 8, [](int x, int) {
+            return x < 4 ? 0xFF0000FFu : 0xFFFFFFFFu;
+        }),
+    };
+}
+
+void FillRects(Renderer& renderer, Assets&)
+{
+    renderer.SetDrawColor(16, 16, 16);
+    renderer.Clear();
+    for (int i = 0; i < 8; ++i)
+    {
+        for (int j = 0; j < 8; ++j)
+        {
+            renderer.SetDrawColor(i * 32, j * 32, 128);
+            renderer.FillRect(Rect(i * 8 + 1, j * 8 + 1, 6, 6));
+        }
+    }
+}
+
+void BlendFills(Renderer& renderer, Assets&)
+{
+    renderer.DrawBlendMode(SDL_BLENDMODE_NONE);
+    renderer.SetDrawColor(0, 0, 255);
+    renderer.Clear();
+    renderer.DrawBlendMode(SDL_BLENDMODE_BLEND);
+    renderer.SetDrawColor(255, 0, 0, 128);
+    renderer.FillRect(Rect(8, 8, 32, 32));
+    renderer.SetDrawColor(0, 255, 0, 64);
+    renderer.FillRect(Rect(24, 24, 32, 32));
+    renderer.DrawBlendMode(SDL_BLENDMODE_NONE);
+}
+
+void Outlines(Renderer& renderer, Assets&)
+{
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.SetDrawColor(255, 255, 255);
+    renderer.DrawRect(Rect(2, 2, 60, 60));
+    renderer.SetDrawColor(255, 0, 255);
+    renderer.DrawLine(5, 32, 58, 32);
+    renderer.DrawLine(32, 5, 32, 58);
+    renderer.SetDrawColor(0, 255, 255);
+    renderer.DrawPoint(10, 10);
+}
+
+void CopyTiles(Renderer& renderer, Assets& assets)
+{
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.FillCopy(assets.checker, std::nullopt, Rect(4, 4, 56, 56));
+}
+
+void ScaledCopy(Renderer& renderer, Assets& assets)
+{
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.Copy(assets.checker, std::nullopt, Rect(0, 0, 64, 64));
+}
+
+void DeferredSprites(Renderer& renderer, Assets& assets)
+{
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.Deferred(true);
+    renderer.Layer(1);
+    renderer.Copy(assets.sprite, std::nullopt, Rect(8, 8, 8, 8));
+    renderer.Layer(0);
+    renderer.Copy(assets.sprite, std::nullopt, Rect(12, 8, 8, 8));
+    renderer.Layer(2);
+    renderer.SetDrawColor(0, 255, 0);
+    renderer.FillRect(Rect(28, 28, 8, 8));
+    renderer.Layer(0);
+    renderer.Deferred(false);
+}
+
+// timed only: many small copies, immediate and batched
+void Sprites(Renderer& renderer, Assets& assets)
+{
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    for (int i = 0; i < 10000; ++i)
+        renderer.Copy(assets.sprite, std::nullopt, Point((i * 7) % 248, (i * 13) % 248));
+}
+
+void DeferredSpritesMany(Renderer& renderer, Assets& assets)
+{
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.Deferred(true);
+    for (int i = 0; i < 10000; ++i)
+        renderer.Copy(assets.sprite, std::nullopt, Point((i * 7) % 248, (i * 13) % 248));
+    renderer.Deferred(false);
+}
+
+void FillCopyLarge(Renderer& renderer, Assets& assets)
+{
+    renderer.FillCopy(assets.checker, std::nullopt, Rect(0, 0, 256, 256));
+}
+
+const Scene kScenes[] = {
+    {"fill_rects", 64, 64, true, 50.0, FillRects},
+    {"blend_fills", 64, 64, true, 50.0, BlendFills},
+    {"outlines", 64, 64, true, 50.0, Outlines},
+    {"copy_tiles", 64, 64, true, 50.0, CopyTiles},
+    {"scaled_copy", 64, 64, true, 50.0, ScaledCopy},
+    {"deferred_sprites", 64, 64, true, 50.0, DeferredSprites},
+    {"sprites_10k", 256, 256, false, 200.0, Sprites},
+    {"deferred_sprites_10k", 256, 256, false, 200.0, DeferredSpritesMany},
+    {"fill_copy_4k_tiles", 256, 256, false, 200.0, FillCopyLarge},
+};
+
+std::string Env(const char* name, const std::string& fallback = std::string())
+{
+    const char* value = std::getenv(name);
+    return value == nullptr ? fallback : std::string(value);
+}
+
+std::string GoldenPath(const std::string& dir, const char* name)
+{
+    return dir + "/" + name + ".bmp";
+}
+
+Surface ReadFrame(Renderer& renderer, int w, int h)
+{
+    Surface frame(0, w, h, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    Surface::LockHandle lock = frame.Lock();
+    renderer.ReadPixels(Rect(0, 0, w, h), SDL_PIXELFORMAT_ARGB8888, lock.Pixels(), lock.Pitch());
+    return frame;
+}
+
+bool Exists(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return false;
+    std::fclose(file);
+    return true;
+}
+
+void SaveFrame(Surface& frame, const std::string& path)
+{
+    if (0 != SDL_SaveBMP(frame.Get(), path.c_str()))
+        ADD_FAILURE() << "SDL_SaveBMP " << path << ": " << SDL_GetError();
+}
+
+// number of pixels whose RGB differs by more than kChannelTolerance
+int Mismatches(Surface& actual, Surface& expected)
+{
+    Surface::LockHandle a = actual.Lock();
+    Surface::LockHandle e = expected.Lock();
+    int count = 0;
+    for (int y = 0; y < actual.Height(); ++y)
+    {
+        const Uint32* arow = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(a.Pixels()) + y * a.Pitch());
+        const Uint32* erow = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(e.Pixels()) + y * e.Pitch());
+        for (int x = 0; x < actual.Width(); ++x)
+        {
+            for (int shift = 0; shift < 24; shift += 8)
+            {
+                const int ac = (arow[x] >> shift) & 0xFF;
+                const int ec = (erow[x] >> shift) & 0xFF;
+                if (std::abs(ac - ec) > kChannelTolerance)
+                {
+                    ++count;
+                    break;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+void CompareWithGolden(Surface& frame, const Scene& scene, const std::string& path)
+{
+    SDL_Surface* loaded = SDL_LoadBMP(path.c_str());
+    ASSERT_NE(loaded, nullptr) << path << ": " << SDL_GetError();
+    Surface expected = Surface(loaded).Convert(SDL_PIXELFORMAT_ARGB8888);
+    ASSERT_EQ(expected.Width(), scene.w);
+    ASSERT_EQ(expected.Height(), scene.h);
+
+    const int mismatches = Mismatches(frame, expected);
+    EXPECT_LE(mismatches, kMismatchTolerance * scene.w * scene.h) << scene.name;
+    if (mismatches > 0)
+        SaveFrame(frame, GoldenPath(Env("TEST_UNDECLARED_OUTPUTS_DIR", "."), scene.name));
+}
+
+double MedianFrameMs(Renderer& renderer, Assets& assets, const Scene& scene)
+{
+    std::vector<double> times;
+    for (int i = 0; i < kTimedFrames; ++i)
+    {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        scene.draw(renderer, assets);
+        renderer.Flush();
+        renderer.Present();
+        const Uint64 end = SDL_GetPerformanceCounter();
+        times.push_back(1000.0 * static_cast<double>(end - start) / static_cast<double>(SDL_GetPerformanceFrequency()));
+    }
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return times[times.size() / 2];
+}
+
+} // namespace
+
+class SDL2wrapperGoldenTest : public ::testing::TestWithParam<Scene>
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+        sdl = new SDL(SDL_INIT_VIDEO);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete sdl;
+        sdl = nullptr;
+    }
+
+    static SDL* sdl;
+};
+
+SDL* SDL2wrapperGoldenTest::sdl = nullptr;
+
+TEST_P(SDL2wrapperGoldenTest, MatchesGoldenInBudget)
+{
+    const Scene& scene = GetParam();
+    Window window(scene.name, 0, 0, scene.w, scene.h, SDL_WINDOW_HIDDEN);
+    Renderer renderer(window, -1, SDL_RENDERER_SOFTWARE);
+    Assets assets = MakeAssets(renderer);
+
+    scene.draw(renderer, assets);
+    Surface frame = ReadFrame(renderer, scene.w, scene.h);
+
+    const std::string update_dir = Env("SDL2WRAPPER_UPDATE_GOLDENS");
+    const std::string path = GoldenPath(Env("SDL2WRAPPER_GOLDEN_DIR", "test/testdata/golden"), scene.name);
+    bool missing = false;
+    if (scene.golden && !update_dir.empty())
+    {
+        SaveFrame(frame, GoldenPath(update_dir, scene.name));
+    }
+    else if (scene.golden && !Exists(path))
+    {
+        missing = true;
+        SaveFrame(frame, GoldenPath(Env("TEST_UNDECLARED_OUTPUTS_DIR", "."), scene.name));
+    }
+    else if (scene.golden)
+    {
+        CompareWithGolden(frame, scene, path);
+    }
+
+    const double scale = std::atof(Env("SDL2WRAPPER_TIME_SCALE", "1").c_str());
+    const double ms = MedianFrameMs(renderer, assets, scene);
+    RecordProperty("median_frame_us", static_cast<int>(ms * 1000.0));
+    EXPECT_LE(ms, scene.budget_ms * scale) << scene.name;
+
+    if (missing)
+        GTEST_SKIP() << "no golden at " << path << "; record one with SDL2WRAPPER_UPDATE_GOLDENS";
+}
+
+INSTANTIATE_TEST_SUITE_P(Scenes, SDL2wrapperGoldenTest, ::testing::ValuesIn(kScenes),
+    [](const ::testing::TestParamInfo<Scene>& info) { return std::string(info.param.name); });
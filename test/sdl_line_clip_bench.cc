@@ -0,0 +1,80 @@
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/LineClip.h"
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+const Rect kView(0, 0, 1920, 1080);
+
+// an oscilloscope trace: mostly on screen, spilling over top and bottom
+std::vector<Point> Trace(int count)
+{
+    std::mt19937 random(1);
+    std::normal_distribution<double> noise(540.0, 400.0);
+    std::vector<Point> points;
+    for (int i = 0; i < count; ++i)
+        points.emplace_back(i * 1920 / count, static_cast<int>(noise(random)));
+    return points;
+}
+
+} // namespace
+
+static void BM_ClipIntersectsLine(benchmark::State& state)
+{
+    std::vector<Point> points = Trace(static_cast<int>(state.range(0)));
+    std::vector<Point> out(points.size());
+
+    for (auto _ : state)
+    {
+        int written = 0;
+        for (size_t i = 0; i + 1 < points.size(); i += 2)
+        {
+            Point a = points[i];
+            Point b = points[i + 1];
+            if (kView.IntersectsLine(a, b))
+            {
+                out[written++] = a;
+                out[written++] = b;
+            }
+        }
+        benchmark::DoNotOptimize(written);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+BENCHMARK(BM_ClipIntersectsLine)->Arg(10000)->Arg(200000);
+
+static void BM_ClipSegments(benchmark::State& state)
+{
+    std::vector<Point> points = Trace(static_cast<int>(state.range(0)));
+    std::vector<Point> out(points.size());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ClipSegments(kView, points.data(), static_cast<int>(points.size()), out.data()));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+BENCHMARK(BM_ClipSegments)->Arg(10000)->Arg(200000);
+
+static void BM_ClipPolyline(benchmark::State& state)
+{
+    std::vector<Point> points = Trace(static_cast<int>(state.range(0)));
+    std::vector<Point> out(2 * points.size());
+    std::vector<int> runs(points.size());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ClipPolyline(kView, points.data(), static_cast<int>(points.size()),
+            out.data(), runs.data()));
+
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_ClipPolyline)->Arg(10000)->Arg(200000);
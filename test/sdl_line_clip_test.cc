@@ -0,0 +1,129 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/LineClip.h"
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+std::vector<Point> RandomPoints(std::mt19937& random, int count)
+{
+    std::uniform_int_distribution<int> coordinate(-100, 200);
+    std::uniform_int_distribution<int> axis(0, 7);
+    std::vector<Point> points;
+    for (int i = 0; i < count; ++i)
+    {
+        Point p(coordinate(random), coordinate(random));
+        // plenty of horizontal and vertical segments too
+        if (i > 0 && axis(random) == 0)
+            p.x = points.back().x;
+        else if (i > 0 && axis(random) == 0)
+            p.y = points.back().y;
+        points.push_back(p);
+    }
+    return points;
+}
+
+} // namespace
+
+TEST(SDL2wrapperLineClipTest, SegmentsMatchIntersectsLine)
+{
+    std::mt19937 random(18);
+    const Rect rects[] = {Rect(0, 0, 100, 100), Rect(-20, 30, 7, 150), Rect(50, 50, 1, 1)};
+    for (const Rect& rect : rects)
+    {
+        // odd counts and several chunks
+        for (int count : {0, 1, 2, 9, 600, 1001})
+        {
+            std::vector<Point> points = RandomPoints(random, count);
+            std::vector<Point> clipped;
+            ClipSegments(rect, points, clipped);
+
+            std::vector<Point> expected;
+            for (int i = 0; i + 1 < count; i += 2)
+            {
+                Point a = points[i];
+                Point b = points[i + 1];
+                if (rect.IntersectsLine(a, b))
+                {
+                    expected.push_back(a);
+                    expected.push_back(b);
+                }
+            }
+            EXPECT_EQ(clipped, expected) << rect << " " << count;
+        }
+    }
+}
+
+TEST(SDL2wrapperLineClipTest, EmptyRectClipsEverything)
+{
+    std::vector<Point> points = {Point(0, 0), Point(10, 10), Point(5, 0)};
+    std::vector<Point> out(4);
+    int runs[2];
+    EXPECT_EQ(ClipSegments(Rect(0, 0, 0, 10), points.data(), 3, out.data()), 0);
+    EXPECT_EQ(ClipPolyline(Rect(0, 0, 10, 0), points.data(), 3, out.data(), runs), 0);
+}
+
+TEST(SDL2wrapperLineClipTest, PolylineKeepsJoinedPiecesTogether)
+{
+    const std::vector<Point> points = {
+        Point(2, 2), Point(8, 2), Point(8, 20), Point(2, 20), Point(2, 4), Point(4, 4)
+    };
+    std::vector<Point> out;
+    std::vector<int> runs;
+    ClipPolyline(Rect(0, 0, 10, 10), points, out, runs);
+
+    EXPECT_EQ(runs, std::vector<int>({3, 3}));
+    EXPECT_EQ(out, std::vector<Point>({
+        Point(2, 2), Point(8, 2), Point(8, 9),
+        Point(2, 9), Point(2, 4), Point(4, 4)
+    }));
+}
+
+TEST(SDL2wrapperLineClipTest, PolylineMatchesIntersectsLine)
+{
+    std::mt19937 random(81);
+    const Rect rect(10, 20, 90, 60);
+    for (int count : {2, 3, 255, 256, 257, 1000})
+    {
+        std::vector<Point> points = RandomPoints(random, count);
+        std::vector<Point> out;
+        std::vector<int> runs;
+        ClipPolyline(rect, points, out, runs);
+
+        // every clipped segment appears, in order, as a step of some run
+        std::vector<Point> steps;
+        int start = 0;
+        for (int run : runs)
+        {
+            ASSERT_GE(run, 2);
+            for (int i = start; i + 1 < start + run; ++i)
+            {
+                steps.push_back(out[i]);
+                steps.push_back(out[i + 1]);
+            }
+            start += run;
+        }
+        EXPECT_EQ(start, static_cast<int>(out.size()));
+
+        std::vector<Point> expected;
+        for (int i = 0; i + 1 < count; ++i)
+        {
+            Point a = points[i];
+            Point b = points[i + 1];
+            if (rect.IntersectsLine(a, b))
+            {
+                expected.push_back(a);
+                expected.push_back(b);
+            }
+        }
+        EXPECT_EQ(steps, expected) << count;
+    }
+}
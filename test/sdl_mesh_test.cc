@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Color.h"
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Mesh.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperMeshTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperMeshTest() :
+        texture(CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 2, 1))
+    {
+        Uint32 texels[2] = {0xFF00FF00u, 0xFF0000FFu};
+        texture.Update(std::nullopt, texels, 8);
+    }
+
+    void Clear()
+    {
+        renderer.SetDrawColor(0, 0, 0);
+        renderer.Clear();
+    }
+
+    Texture texture;
+};
+
+TEST_F(SDL2wrapperMeshTest, Build)
+{
+    Mesh mesh(&texture);
+    EXPECT_TRUE(mesh.Empty());
+    EXPECT_EQ(mesh.GetTexture(), texture.Get());
+
+    EXPECT_EQ(mesh.AddQuad(Rect(0, 0, 1, 1), FRect(0.0f, 0.0f, 8.0f, 8.0f)), 0);
+    EXPECT_EQ(mesh.AddQuad(Rect(1, 0, 1, 1), FRect(8.0f, 0.0f, 8.0f, 8.0f)), 4);
+    EXPECT_EQ(mesh.VertexCount(), 8);
+    EXPECT_EQ(mesh.IndexCount(), 12);
+    EXPECT_EQ(mesh.Indices()[6], 4);
+
+    // texel coordinates are normalized by the texture size
+    EXPECT_FLOAT_EQ(mesh.Vertices()[5].tex_coord.x, 1.0f);
+    EXPECT_FLOAT_EQ(mesh.Vertices()[4].tex_coord.x, 0.5f);
+
+    mesh.Clear();
+    EXPECT_TRUE(mesh.Empty());
+    EXPECT_EQ(mesh.IndexCount(), 0);
+    EXPECT_EQ(mesh.Indices(), nullptr);
+}
+
+TEST_F(SDL2wrapperMeshTest, Draw)
+{
+    Mesh mesh(&texture);
+    mesh.AddQuad(Rect(0, 0, 1, 1), FRect(0.0f, 0.0f, 8.0f, 8.0f));
+    mesh.AddQuad(Rect(1, 0, 1, 1), FRect(8.0f, 0.0f, 8.0f, 8.0f));
+
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFF00FF00u);
+    EXPECT_EQ(Pixel(12, 4), 0xFF0000FFu);
+    EXPECT_EQ(Pixel(20, 4), 0xFF000000u);
+
+    // the same data is drawn again without being rebuilt
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFF00FF00u);
+}
+
+TEST_F(SDL2wrapperMeshTest, PartialUpdates)
+{
+    Mesh mesh(&texture);
+    mesh.AddQuad(Rect(0, 0, 1, 1), FRect(0.0f, 0.0f, 8.0f, 8.0f));
+    int second = mesh.AddQuad(Rect(0, 0, 1, 1), FRect(8.0f, 0.0f, 8.0f, 8.0f));
+
+    mesh.UpdateQuad(second, Rect(1, 0, 1, 1), FRect(8.0f, 0.0f, 8.0f, 8.0f));
+    mesh.Translate(second, 4, FPoint(0.0f, 16.0f));
+
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFF00FF00u);
+    EXPECT_EQ(Pixel(12, 4), 0xFF000000u);
+    EXPECT_EQ(Pixel(12, 20), 0xFF0000FFu);
+
+    // vertex colors modulate the texture
+    mesh.SetColor(0, 4, Color(0, 0, 0));
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFF000000u);
+
+    SDL_Vertex vertices[4];
+    std::copy(mesh.Vertices(), mesh.Vertices() + 4, vertices);
+    for (SDL_Vertex& v : vertices)
+        v.color = Color(255, 255, 255);
+    mesh.UpdateVertices(0, vertices, 4);
+
+    // drop the second quad by pointing its triangles at the first one
+    const int first_quad[6] = {0, 1, 2, 0, 2, 3};
+    mesh.UpdateIndices(6, first_quad, 6);
+
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFF00FF00u);
+    EXPECT_EQ(Pixel(12, 20), 0xFF000000u);
+}
+
+TEST_F(SDL2wrapperMeshTest, Untextured)
+{
+    Mesh mesh;
+    EXPECT_EQ(mesh.GetTexture(), nullptr);
+
+    // without indices the vertices form a triangle list
+    const SDL_Color red = {255, 0, 0, 255};
+    std::vector<SDL_Vertex> triangle = {
+        {{0.0f, 0.0f}, red, {0.0f, 0.0f}},
+        {{32.0f, 0.0f}, red, {0.0f, 0.0f}},
+        {{0.0f, 32.0f}, red, {0.0f, 0.0f}},
+    };
+    EXPECT_EQ(mesh.AddVertices(triangle), 0);
+    EXPECT_EQ(mesh.IndexCount(), 0);
+
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(30, 30), 0xFF000000u);
+
+    // indices added after raw vertices cover all of them
+    mesh.AddIndices({0, 1, 2});
+    mesh.AddQuad(FRect(32.0f, 32.0f, 8.0f, 8.0f), Color(0, 0, 255));
+
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(36, 36), 0xFF0000FFu);
+}
+
+TEST_F(SDL2wrapperMeshTest, QuadAfterTriangleList)
+{
+    Mesh mesh;
+    const SDL_Color red = {255, 0, 0, 255};
+    std::vector<SDL_Vertex> triangle = {
+        {{0.0f, 0.0f}, red, {0.0f, 0.0f}},
+        {{32.0f, 0.0f}, red, {0.0f, 0.0f}},
+        {{0.0f, 32.0f}, red, {0.0f, 0.0f}},
+    };
+    mesh.AddVertices(triangle);
+
+    // the triangle list is indexed before the quad's own indices
+    EXPECT_EQ(mesh.AddQuad(FRect(32.0f, 32.0f, 8.0f, 8.0f), Color(0, 0, 255)), 3);
+    EXPECT_EQ(mesh.IndexCount(), 9);
+    EXPECT_EQ(mesh.Indices()[2], 2);
+    EXPECT_EQ(mesh.Indices()[3], 3);
+
+    Clear();
+    renderer.Draw(mesh);
+    EXPECT_EQ(Pixel(4, 4), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(36, 36), 0xFF0000FFu);
+}
@@ -0,0 +1,124 @@
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectArray.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+std::vector<Rect> RandomRects(int count)
+{
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> position(0, 4000);
+    std::uniform_int_distribution<int> size(1, 64);
+    std::vector<Rect> rects;
+    for (int i = 0; i < count; ++i)
+        rects.emplace_back(position(random), position(random), size(random), size(random));
+    return rects;
+}
+
+const Rect kQuery(1000, 1000, 500, 500);
+
+// range(1) picks the kernel; false when the CPU lacks it
+bool UseKernel(benchmark::State& state)
+{
+    if (detail::UseRectKernel(static_cast<detail::RectKernel>(state.range(1))))
+        return true;
+    state.SkipWithError("kernel not supported by this CPU");
+    return false;
+}
+
+// every size for each kernel
+void KernelArgs(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"n", "kernel"});
+    for (detail::RectKernel kernel : {detail::RectKernel::kScalar, detail::RectKernel::kSse41, detail::RectKernel::kAvx2})
+        for (int count : {1000, 10000, 100000})
+            benchmark->Args({count, static_cast<int>(kernel)});
+}
+
+} // namespace
+
+static void BM_IntersectsScalar(benchmark::State& state)
+{
+    std::vector<Rect> rects = RandomRects(static_cast<int>(state.range(0)));
+    std::vector<int> indices(rects.size());
+
+    for (auto _ : state)
+    {
+        int count = 0;
+        for (int i = 0; i < static_cast<int>(rects.size()); ++i)
+            if (rects[i].Intersects(kQuery))
+                indices[count++] = i;
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntersectsScalar)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_IntersectsMask(benchmark::State& state)
+{
+    if (!UseKernel(state))
+        return;
+    RectArray rects(RandomRects(static_cast<int>(state.range(0))));
+    std::vector<Uint64> mask(rects.MaskWords());
+
+    for (auto _ : state)
+    {
+        rects.Intersects(kQuery, mask.data());
+        benchmark::DoNotOptimize(mask.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntersectsMask)->Apply(KernelArgs);
+
+static void BM_IntersectsIndices(benchmark::State& state)
+{
+    if (!UseKernel(state))
+        return;
+    RectArray rects(RandomRects(static_cast<int>(state.range(0))));
+    std::vector<int> indices(rects.Size());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rects.Intersects(kQuery, indices.data()));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IntersectsIndices)->Apply(KernelArgs);
+
+static void BM_BoundsScalar(benchmark::State& state)
+{
+    std::vector<Rect> rects = RandomRects(static_cast<int>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        Rect bounds = rects[0];
+        for (const Rect& rect : rects)
+            bounds.MakeUnionWith(rect);
+        benchmark::DoNotOptimize(bounds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BoundsScalar)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_Bounds(benchmark::State& state)
+{
+    if (!UseKernel(state))
+        return;
+    RectArray rects(RandomRects(static_cast<int>(state.range(0))));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rects.Bounds());
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Bounds)->Apply(KernelArgs);
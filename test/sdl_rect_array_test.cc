@@ -0,0 +1,134 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectArray.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+std::vector<Rect> RandomRects(std::mt19937& random, int count)
+{
+    std::uniform_int_distribution<int> position(-50, 250);
+    std::uniform_int_distribution<int> size(0, 80);
+    std::vector<Rect> rects;
+    for (int i = 0; i < count; ++i)
+        rects.emplace_back(position(random), position(random), size(random), size(random));
+    return rects;
+}
+
+bool Bit(const std::vector<Uint64>& mask, int i)
+{
+    return (mask[i / 64] >> (i % 64)) & 1;
+}
+
+} // namespace
+
+// Every test runs once per kernel; kernels the CPU lacks are skipped.
+class SDL2wrapperRectArrayTest : public ::testing::TestWithParam<detail::RectKernel>
+{
+protected:
+    void SetUp() override
+    {
+        best_ = detail::ActiveRectKernel();
+        if (!detail::UseRectKernel(GetParam()))
+            GTEST_SKIP() << "kernel not supported by this CPU";
+    }
+
+    void TearDown() override
+    {
+        detail::UseRectKernel(best_);
+    }
+
+    detail::RectKernel best_;
+};
+
+TEST_P(SDL2wrapperRectArrayTest, StoresRects)
+{
+    RectArray array;
+    EXPECT_EQ(array.Size(), 0);
+    EXPECT_EQ(array.Bounds(), Rect());
+
+    array.Add(Rect(1, 2, 3, 4)).Add(Rect(-5, 10, 2, 2));
+    EXPECT_EQ(array.Size(), 2);
+    EXPECT_EQ(array.MaskWords(), 1);
+    EXPECT_EQ(array.Get(0), Rect(1, 2, 3, 4));
+    EXPECT_EQ(array.Get(1), Rect(-5, 10, 2, 2));
+    EXPECT_EQ(array.Bounds(), Rect(-5, 2, 9, 10));
+
+    array.Set(1, Rect(0, 0, 1, 1));
+    EXPECT_EQ(array.Bounds(), Rect(0, 0, 4, 6));
+
+    array.Clear();
+    EXPECT_EQ(array.Size(), 0);
+}
+
+TEST_P(SDL2wrapperRectArrayTest, MatchesScalarRect)
+{
+    std::mt19937 random(5);
+    // sizes around the block and mask word boundaries
+    for (int count : {1, 7, 8, 9, 63, 64, 65, 200})
+    {
+        std::vector<Rect> rects = RandomRects(random, count);
+        RectArray array(rects);
+        std::vector<Uint64> mask(array.MaskWords());
+        std::vector<int> indices(count);
+
+        Rect bounds = rects[0];
+        for (const Rect& r : rects)
+            bounds.MakeUnionWith(r);
+        EXPECT_EQ(array.Bounds(), bounds);
+
+        for (const Rect& query : RandomRects(random, 20))
+        {
+            array.Intersects(query, mask.data());
+            int n = array.Intersects(query, indices.data());
+            int expected = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                bool hit = rects[i].Intersects(query);
+                ASSERT_EQ(Bit(mask, i), hit) << rects[i] << " " << query;
+                if (hit)
+                {
+                    EXPECT_EQ(indices[expected++], i);
+                }
+            }
+            EXPECT_EQ(n, expected);
+
+            array.Contains(query, mask.data());
+            for (int i = 0; i < count; ++i)
+                ASSERT_EQ(Bit(mask, i), rects[i].Contains(query)) << rects[i] << " " << query;
+
+            Point p = query.TopLeft();
+            array.Contains(p, mask.data());
+            n = array.Contains(p, indices.data());
+            expected = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(Bit(mask, i), rects[i].Contains(p)) << rects[i] << " " << p;
+                expected += rects[i].Contains(p) ? 1 : 0;
+            }
+            EXPECT_EQ(n, expected);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernel, SDL2wrapperRectArrayTest,
+    ::testing::Values(detail::RectKernel::kScalar, detail::RectKernel::kSse41, detail::RectKernel::kAvx2),
+    [](const ::testing::TestParamInfo<detail::RectKernel>& info) {
+        switch (info.param)
+        {
+        case detail::RectKernel::kSse41:
+            return "Sse41";
+        case detail::RectKernel::kAvx2:
+            return "Avx2";
+        default:
+            return "Scalar";
+        }
+    });
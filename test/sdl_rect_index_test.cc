@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectIndex.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+Rect RandomRect(std::mt19937& random, int max_size)
+{
+    // some rects fall partly or wholly outside the indexed bounds
+    std::uniform_int_distribution<int> position(-100, 1100);
+    std::uniform_int_distribution<int> size(1, max_size);
+    return Rect(position(random), position(random), size(random), size(random));
+}
+
+std::vector<int> BruteForce(const std::vector<Rect>& rects, const std::vector<bool>& alive, const Rect& area)
+{
+    std::vector<int> found;
+    for (std::size_t i = 0; i < rects.size(); ++i)
+    {
+        if (alive[i] && rects[i].Intersects(area))
+            found.push_back(static_cast<int>(i));
+    }
+    return found;
+}
+
+template <typename Index>
+void CheckAgainstBruteForce(Index& index, int max_size)
+{
+    std::mt19937 random(11);
+    std::vector<Rect> rects;
+    std::vector<bool> alive;
+    for (int i = 0; i < 2000; ++i)
+    {
+        Rect r = RandomRect(random, max_size);
+        ASSERT_EQ(index.Insert(r), i);
+        rects.push_back(r);
+        alive.push_back(true);
+    }
+
+    std::uniform_int_distribution<int> pick(0, 1999);
+    for (int i = 0; i < 500; ++i)
+    {
+        int h = pick(random);
+        if (!alive[h])
+            continue;
+        if (i % 3 == 0)
+        {
+            index.Remove(h);
+            alive[h] = false;
+        }
+        else
+        {
+            rects[h] = RandomRect(random, max_size);
+            index.Update(h, rects[h]);
+        }
+    }
+    EXPECT_EQ(index.Size(), static_cast<int>(std::count(alive.begin(), alive.end(), true)));
+
+    std::vector<int> found;
+    for (int i = 0; i < 200; ++i)
+    {
+        Rect area = RandomRect(random, 300);
+        index.Query(area, found);
+        std::sort(found.begin(), found.end());
+        ASSERT_EQ(found, BruteForce(rects, alive, area)) << area;
+    }
+
+    int buffer[4];
+    for (int i = 0; i < 200; ++i)
+    {
+        Rect area = RandomRect(random, 1);
+        int count = index.Query(area.TopLeft(), buffer, 4);
+        std::vector<int> expected = BruteForce(rects, alive, area);
+        ASSERT_EQ(count, static_cast<int>(expected.size()));
+        for (int k = 0; k < std::min(count, 4); ++k)
+            EXPECT_TRUE(std::find(expected.begin(), expected.end(), buffer[k]) != expected.end());
+    }
+}
+
+} // namespace
+
+TEST(SDL2wrapperRectIndexTest, GridMatchesBruteForce)
+{
+    GridIndex index(Rect(0, 0, 1000, 1000), 64);
+    CheckAgainstBruteForce(index, 40);
+}
+
+TEST(SDL2wrapperRectIndexTest, GridWithLargeRects)
+{
+    GridIndex index(Rect(0, 0, 1000, 1000), 32);
+    CheckAgainstBruteForce(index, 400);
+}
+
+TEST(SDL2wrapperRectIndexTest, QuadtreeMatchesBruteForce)
+{
+    QuadtreeIndex index(Rect(0, 0, 1000, 1000));
+    CheckAgainstBruteForce(index, 40);
+}
+
+TEST(SDL2wrapperRectIndexTest, QuadtreeWithMixedSizes)
+{
+    QuadtreeIndex index(Rect(0, 0, 1000, 1000), 8);
+    CheckAgainstBruteForce(index, 900);
+}
+
+TEST(SDL2wrapperRectIndexTest, HandlesAreReused)
+{
+    GridIndex grid(Rect(0, 0, 100, 100), 10);
+    QuadtreeIndex tree(Rect(0, 0, 100, 100));
+
+    int a = grid.Insert(Rect(1, 1, 5, 5));
+    grid.Insert(Rect(50, 50, 5, 5));
+    grid.Remove(a);
+    EXPECT_EQ(grid.Insert(Rect(20, 20, 5, 5)), a);
+    EXPECT_EQ(grid.Get(a), Rect(20, 20, 5, 5));
+
+    int b = tree.Insert(Rect(1, 1, 5, 5));
+    tree.Remove(b);
+    EXPECT_EQ(tree.Insert(Rect(70, 70, 5, 5)), b);
+    EXPECT_EQ(tree.Size(), 1);
+
+    int buffer[2];
+    EXPECT_EQ(tree.Query(Point(72, 72), buffer, 2), 1);
+    EXPECT_EQ(buffer[0], b);
+    EXPECT_EQ(tree.Query(Point(2, 2), buffer, 2), 0);
+
+    grid.Clear();
+    tree.Clear();
+    EXPECT_EQ(grid.Size(), 0);
+    EXPECT_EQ(tree.Query(Rect(0, 0, 100, 100), buffer, 2), 0);
+}
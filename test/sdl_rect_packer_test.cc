@@ -0,0 +1,93 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectPacker.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+void ExpectDisjointAndInside(const std::vector<Rect>& rects, int width, int height)
+{
+    const Rect bounds(0, 0, width, height);
+    for (std::size_t i = 0; i < rects.size(); ++i)
+    {
+        EXPECT_TRUE(bounds.Contains(rects[i])) << rects[i];
+        for (std::size_t j = i + 1; j < rects.size(); ++j)
+            EXPECT_FALSE(rects[i].Intersects(rects[j])) << rects[i] << " " << rects[j];
+    }
+}
+
+} // namespace
+
+TEST(SDL2wrapperRectPackerTest, FillsExactly)
+{
+    RectPacker packer(64, 64);
+    std::vector<Rect> placed;
+    for (int i = 0; i < 4; ++i)
+    {
+        std::optional<Rect> r = packer.Insert(32, 32);
+        ASSERT_TRUE(r);
+        placed.push_back(*r);
+    }
+
+    ExpectDisjointAndInside(placed, 64, 64);
+    EXPECT_DOUBLE_EQ(packer.Occupancy(), 1.0);
+    EXPECT_TRUE(packer.FreeRects().empty());
+    EXPECT_FALSE(packer.Insert(1, 1));
+}
+
+TEST(SDL2wrapperRectPackerTest, RejectsWhatCannotFit)
+{
+    RectPacker packer(64, 32);
+    EXPECT_FALSE(packer.Insert(65, 1));
+    EXPECT_FALSE(packer.Insert(1, 33));
+    EXPECT_FALSE(packer.Insert(0, 10));
+    EXPECT_TRUE(packer.Insert(64, 32));
+    EXPECT_FALSE(packer.Insert(1, 1));
+
+    packer.Clear();
+    EXPECT_DOUBLE_EQ(packer.Occupancy(), 0.0);
+    EXPECT_EQ(packer.Insert(10, 10), Rect(0, 0, 10, 10));
+}
+
+TEST(SDL2wrapperRectPackerTest, BestShortSideFit)
+{
+    RectPacker packer(100, 100);
+    EXPECT_EQ(packer.Insert(100, 40), Rect(0, 0, 100, 40));
+    EXPECT_EQ(packer.Insert(30, 60), Rect(0, 40, 30, 60));
+    // a 70x60 hole remains and is filled exactly
+    EXPECT_EQ(packer.Insert(70, 60), Rect(30, 40, 70, 60));
+    EXPECT_DOUBLE_EQ(packer.Occupancy(), 1.0);
+}
+
+TEST(SDL2wrapperRectPackerTest, RandomSizesDoNotOverlap)
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> size(1, 48);
+
+    RectPacker packer(512, 512);
+    std::vector<Rect> placed;
+    int area = 0;
+    for (int i = 0; i < 2000; ++i)
+    {
+        int w = size(rng);
+        int h = size(rng);
+        if (std::optional<Rect> r = packer.Insert(w, h))
+        {
+            EXPECT_EQ(r->w, w);
+            EXPECT_EQ(r->h, h);
+            placed.push_back(*r);
+            area += w * h;
+        }
+    }
+
+    ExpectDisjointAndInside(placed, 512, 512);
+    EXPECT_DOUBLE_EQ(packer.Occupancy(), area / (512.0 * 512.0));
+    EXPECT_GT(packer.Occupancy(), 0.8);
+}
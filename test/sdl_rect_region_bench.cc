@@ -0,0 +1,186 @@
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectRegion.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+constexpr int kWorld = 4096;
+
+std::vector<Rect> RandomRects(int count, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> position(0, kWorld - 64);
+    std::uniform_int_distribution<int> size(4, 64);
+    std::vector<Rect> rects;
+    rects.reserve(count);
+    for (int i = 0; i < count; ++i)
+        rects.emplace_back(position(random), position(random), size(random), size(random));
+    return rects;
+}
+
+// The hand-rolled alternative: a list of disjoint rects, kept disjoint by
+// cutting every new rect against all the old ones.
+void NaiveSubtract(const Rect& r, const Rect& cut, std::vector<Rect>& out)
+{
+    std::optional<Rect> overlap = r.GetIntersection(cut);
+    if (overlap == std::nullopt)
+    {
+        out.push_back(r);
+        return;
+    }
+    if (overlap->y > r.y)
+        out.emplace_back(r.x, r.y, r.w, overlap->y - r.y);
+    if (overlap->Y2() < r.Y2())
+        out.emplace_back(r.x, overlap->Y2() + 1, r.w, r.Y2() - overlap->Y2());
+    if (overlap->x > r.x)
+        out.emplace_back(r.x, overlap->y, overlap->x - r.x, overlap->h);
+    if (overlap->X2() < r.X2())
+        out.emplace_back(overlap->X2() + 1, overlap->y, r.X2() - overlap->X2(), overlap->h);
+}
+
+std::vector<Rect> NaiveUnion(const std::vector<Rect>& rects)
+{
+    std::vector<Rect> disjoint;
+    std::vector<Rect> pieces;
+    std::vector<Rect> next;
+    for (const Rect& r : rects)
+    {
+        pieces.assign(1, r);
+        for (const Rect& old : disjoint)
+        {
+            next.clear();
+            for (const Rect& p : pieces)
+                NaiveSubtract(p, old, next);
+            pieces.swap(next);
+            if (pieces.empty())
+                break;
+        }
+        disjoint.insert(disjoint.end(), pieces.begin(), pieces.end());
+    }
+    return disjoint;
+}
+
+std::vector<Rect> NaiveDifference(const std::vector<Rect>& a, const std::vector<Rect>& b)
+{
+    std::vector<Rect> pieces = a;
+    std::vector<Rect> next;
+    for (const Rect& cut : b)
+    {
+        next.clear();
+        for (const Rect& p : pieces)
+            NaiveSubtract(p, cut, next);
+        pieces.swap(next);
+    }
+    return pieces;
+}
+
+} // namespace
+
+static void BM_RegionUnion(benchmark::State& state)
+{
+    std::vector<Rect> rects = RandomRects(static_cast<int>(state.range(0)), 1);
+    for (auto _ : state)
+    {
+        RectRegion region(rects);
+        benchmark::DoNotOptimize(region.Size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RegionUnion)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_NaiveUnion(benchmark::State& state)
+{
+    std::vector<Rect> rects = RandomRects(static_cast<int>(state.range(0)), 1);
+    for (auto _ : state)
+    {
+        std::vector<Rect> disjoint = NaiveUnion(rects);
+        benchmark::DoNotOptimize(disjoint.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NaiveUnion)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_RegionDifference(benchmark::State& state)
+{
+    RectRegion a(RandomRects(static_cast<int>(state.range(0)), 1));
+    RectRegion b(RandomRects(static_cast<int>(state.range(0)), 2));
+    for (auto _ : state)
+    {
+        RectRegion d = a.Difference(b);
+        benchmark::DoNotOptimize(d.Size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RegionDifference)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_NaiveDifference(benchmark::State& state)
+{
+    std::vector<Rect> a = NaiveUnion(RandomRects(static_cast<int>(state.range(0)), 1));
+    std::vector<Rect> b = RandomRects(static_cast<int>(state.range(0)), 2);
+    for (auto _ : state)
+    {
+        std::vector<Rect> d = NaiveDifference(a, b);
+        benchmark::DoNotOptimize(d.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NaiveDifference)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_RegionContains(benchmark::State& state)
+{
+    RectRegion region(RandomRects(static_cast<int>(state.range(0)), 1));
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> position(0, kWorld - 1);
+    std::vector<Point> points;
+    for (int i = 0; i < 1024; ++i)
+        points.emplace_back(position(random), position(random));
+
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (const Point& p : points)
+            hits += region.Contains(p) ? 1 : 0;
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+BENCHMARK(BM_RegionContains)->Arg(1000)->Arg(10000);
+
+static void BM_NaiveContains(benchmark::State& state)
+{
+    std::vector<Rect> rects = NaiveUnion(RandomRects(static_cast<int>(state.range(0)), 1));
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> position(0, kWorld - 1);
+    std::vector<Point> points;
+    for (int i = 0; i < 1024; ++i)
+        points.emplace_back(position(random), position(random));
+
+    for (auto _ : state)
+    {
+        int hits = 0;
+        for (const Point& p : points)
+        {
+            for (const Rect& r : rects)
+            {
+                if (r.Contains(p))
+                {
+                    ++hits;
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+BENCHMARK(BM_NaiveContains)->Arg(1000)->Arg(10000);
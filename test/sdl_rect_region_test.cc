@@ -0,0 +1,196 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RectRegion.h"
+
+using namespace sdl2;
+
+namespace
+{
+
+constexpr int kSize = 64;
+
+// pixel mask of a region, for checking against brute force
+std::vector<bool> Mask(const RectRegion& region)
+{
+    std::vector<bool> mask(kSize * kSize, false);
+    for (const Rect& r : region)
+    {
+        for (int y = r.y; y < r.y + r.h; ++y)
+        {
+            for (int x = r.x; x < r.x + r.w; ++x)
+                mask[y * kSize + x] = true;
+        }
+    }
+    return mask;
+}
+
+std::vector<bool> Mask(const std::vector<Rect>& rects)
+{
+    std::vector<bool> mask(kSize * kSize, false);
+    for (const Rect& r : rects)
+    {
+        for (int y = r.y; y < r.y + r.h; ++y)
+        {
+            for (int x = r.x; x < r.x + r.w; ++x)
+                mask[y * kSize + x] = true;
+        }
+    }
+    return mask;
+}
+
+void ExpectBanded(const RectRegion& region)
+{
+    const std::vector<Rect>& rects = region.Rects();
+    for (std::size_t i = 0; i < rects.size(); ++i)
+    {
+        EXPECT_GT(rects[i].w, 0);
+        EXPECT_GT(rects[i].h, 0);
+        for (std::size_t j = i + 1; j < rects.size(); ++j)
+            EXPECT_FALSE(rects[i].Intersects(rects[j])) << rects[i] << " " << rects[j];
+        if (i + 1 < rects.size())
+        {
+            const Rect& a = rects[i];
+            const Rect& b = rects[i + 1];
+            if (a.y == b.y)
+            {
+                EXPECT_EQ(a.h, b.h);
+                // spans in a band are sorted and never touch
+                EXPECT_LT(a.x + a.w, b.x);
+            }
+            else
+            {
+                EXPECT_GE(b.y, a.y + a.h);
+            }
+        }
+    }
+}
+
+std::vector<Rect> RandomRects(std::mt19937& random, int count)
+{
+    std::uniform_int_distribution<int> position(0, kSize - 1);
+    std::vector<Rect> rects;
+    for (int i = 0; i < count; ++i)
+    {
+        int x = position(random);
+        int y = position(random);
+        std::uniform_int_distribution<int> w(1, kSize - x);
+        std::uniform_int_distribution<int> h(1, kSize - y);
+        rects.emplace_back(x, y, std::min(w(random), 20), std::min(h(random), 20));
+    }
+    return rects;
+}
+
+} // namespace
+
+TEST(SDL2wrapperRectRegionTest, EmptyAndSingle)
+{
+    RectRegion empty;
+    EXPECT_TRUE(empty.Empty());
+    EXPECT_EQ(empty.Bounds(), Rect());
+    EXPECT_TRUE(RectRegion(Rect(5, 5, 0, 10)).Empty());
+
+    RectRegion single(Rect(2, 3, 4, 5));
+    EXPECT_EQ(single.Size(), 1);
+    EXPECT_EQ(single.Area(), 20);
+    EXPECT_EQ(single.Bounds(), Rect(2, 3, 4, 5));
+    EXPECT_TRUE(single.Contains(Point(2, 3)));
+    EXPECT_TRUE(single.Contains(Point(5, 7)));
+    EXPECT_FALSE(single.Contains(Point(6, 7)));
+    EXPECT_FALSE(single.Contains(Point(5, 8)));
+}
+
+TEST(SDL2wrapperRectRegionTest, UnionCoalesces)
+{
+    // two halves of one rect, side by side and stacked
+    EXPECT_EQ(RectRegion(Rect(0, 0, 5, 10)).Union(RectRegion(Rect(5, 0, 5, 10))), RectRegion(Rect(0, 0, 10, 10)));
+    EXPECT_EQ(RectRegion(Rect(0, 0, 10, 5)).Union(RectRegion(Rect(0, 5, 10, 5))), RectRegion(Rect(0, 0, 10, 10)));
+
+    RectRegion cross = RectRegion(Rect(10, 0, 10, 30)).Union(RectRegion(Rect(0, 10, 30, 10)));
+    EXPECT_EQ(cross.Size(), 3);
+    EXPECT_EQ(cross.Area(), 500);
+    ExpectBanded(cross);
+}
+
+TEST(SDL2wrapperRectRegionTest, SubtractPunchesHole)
+{
+    RectRegion frame = RectRegion(Rect(0, 0, 30, 30)).Difference(RectRegion(Rect(10, 10, 10, 10)));
+    EXPECT_EQ(frame.Size(), 4);
+    EXPECT_EQ(frame.Area(), 800);
+    EXPECT_FALSE(frame.Contains(Point(15, 15)));
+    EXPECT_TRUE(frame.Contains(Point(5, 15)));
+    EXPECT_FALSE(frame.Contains(Rect(5, 5, 10, 10)));
+    EXPECT_TRUE(frame.Contains(Rect(0, 0, 30, 10)));
+    EXPECT_TRUE(frame.Contains(Rect(0, 0, 10, 30)));
+    EXPECT_TRUE(frame.Intersects(Rect(5, 5, 10, 10)));
+    EXPECT_FALSE(frame.Intersects(Rect(12, 12, 5, 5)));
+    ExpectBanded(frame);
+
+    EXPECT_TRUE(RectRegion(Rect(0, 0, 5, 5)).Difference(RectRegion(Rect(0, 0, 10, 10))).Empty());
+}
+
+TEST(SDL2wrapperRectRegionTest, IntersectAndTranslate)
+{
+    RectRegion a(Rect(0, 0, 20, 20));
+    RectRegion b(Rect(10, 10, 20, 20));
+    EXPECT_EQ(a.Intersection(b), RectRegion(Rect(10, 10, 10, 10)));
+    EXPECT_TRUE(a.Intersection(RectRegion(Rect(20, 0, 5, 5))).Empty());
+
+    a.Translate(Point(10, 10));
+    EXPECT_EQ(a.Bounds(), Rect(10, 10, 20, 20));
+    EXPECT_EQ(a, b);
+}
+
+TEST(SDL2wrapperRectRegionTest, MatchesBruteForce)
+{
+    std::mt19937 random(42);
+    for (int round = 0; round < 50; ++round)
+    {
+        std::vector<Rect> ra = RandomRects(random, 1 + round % 12);
+        std::vector<Rect> rb = RandomRects(random, 1 + round % 7);
+        RectRegion a(ra);
+        RectRegion b(rb);
+        ExpectBanded(a);
+        ASSERT_EQ(Mask(a), Mask(ra));
+
+        std::vector<bool> ma = Mask(ra);
+        std::vector<bool> mb = Mask(rb);
+        std::vector<bool> u(ma.size()), i(ma.size()), d(ma.size());
+        for (std::size_t p = 0; p < ma.size(); ++p)
+        {
+            u[p] = ma[p] || mb[p];
+            i[p] = ma[p] && mb[p];
+            d[p] = ma[p] && !mb[p];
+        }
+
+        RectRegion ru = a.Union(b);
+        RectRegion ri = a.Intersection(b);
+        RectRegion rd = a.Difference(b);
+        ExpectBanded(ru);
+        ExpectBanded(ri);
+        ExpectBanded(rd);
+        EXPECT_EQ(Mask(ru), u);
+        EXPECT_EQ(Mask(ri), i);
+        EXPECT_EQ(Mask(rd), d);
+
+        // the banded form is canonical
+        EXPECT_EQ(ru, b.Union(a));
+        EXPECT_EQ(ru, rd.Union(b));
+
+        for (int y = 0; y < kSize; y += 3)
+        {
+            for (int x = 0; x < kSize; x += 3)
+                ASSERT_EQ(ru.Contains(Point(x, y)), u[y * kSize + x]) << x << "," << y;
+        }
+        for (const Rect& r : rb)
+        {
+            EXPECT_TRUE(ru.Contains(r));
+            EXPECT_FALSE(rd.Intersects(r));
+        }
+    }
+}
@@ -335,6 +335,11 @@ TEST_F(SDL2wrapperRectOperations, MakeUnion)
     };
     a.MakeUnionWith(b);
     EXPECT_EQ(a, expected);
+
+    // growing left or up must keep the far edges
+    Rect c(10, 10, 5, 5);
+    c.MakeUnionWith(Rect(0, 0, 5, 5));
+    EXPECT_EQ(c, Rect(0, 0, 15, 15));
 }
 
 TEST_F(SDL2wrapperRectOperations, Extension)
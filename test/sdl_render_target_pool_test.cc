@@ -0,0 +1,110 @@
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/RenderTargetPool.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperRenderTargetPoolTest : public SDL2wrapperSoftwareRendererTest
+{
+};
+
+TEST_F(SDL2wrapperRenderTargetPoolTest, ReusesReleasedTargets)
+{
+    RenderTargetPool pool(renderer);
+
+    SDL_Texture* first = nullptr;
+    {
+        RenderTargetPool::Lease lease = pool.Acquire(32, 16);
+        ASSERT_TRUE(lease);
+        EXPECT_EQ(lease->Width(), 32);
+        EXPECT_EQ(lease->Height(), 16);
+        EXPECT_EQ(lease->Access(), SDL_TEXTUREACCESS_TARGET);
+        first = lease->Get();
+        EXPECT_EQ(pool.Leased(), 1);
+    }
+    EXPECT_EQ(pool.Leased(), 0);
+
+    RenderTargetPool::Lease again = pool.Acquire(32, 16);
+    EXPECT_EQ(again->Get(), first);
+    EXPECT_EQ(pool.Hits(), 1u);
+    EXPECT_EQ(pool.Misses(), 1u);
+    EXPECT_EQ(pool.Size(), 1);
+}
+
+TEST_F(SDL2wrapperRenderTargetPoolTest, BucketsBySizeAndFormat)
+{
+    RenderTargetPool pool(renderer);
+
+    RenderTargetPool::Lease a = pool.Acquire(32, 16);
+    RenderTargetPool::Lease b = pool.Acquire(32, 16);
+    RenderTargetPool::Lease c = pool.Acquire(16, 32);
+    RenderTargetPool::Lease d = pool.Acquire(32, 16, SDL_PIXELFORMAT_ABGR8888);
+
+    EXPECT_NE(a->Get(), b->Get());
+    EXPECT_EQ(d->Format(), static_cast<Uint32>(SDL_PIXELFORMAT_ABGR8888));
+    EXPECT_EQ(pool.Misses(), 4u);
+    EXPECT_EQ(pool.Hits(), 0u);
+    EXPECT_EQ(pool.Leased(), 4);
+}
+
+TEST_F(SDL2wrapperRenderTargetPoolTest, LeaseMovesAndReleases)
+{
+    RenderTargetPool pool(renderer);
+
+    RenderTargetPool::Lease a = pool.Acquire(8, 8);
+    RenderTargetPool::Lease b = std::move(a);
+    EXPECT_FALSE(a);
+    EXPECT_TRUE(b);
+    EXPECT_EQ(pool.Leased(), 1);
+
+    b.Release();
+    EXPECT_FALSE(b);
+    EXPECT_EQ(pool.Leased(), 0);
+}
+
+TEST_F(SDL2wrapperRenderTargetPoolTest, TrimsIdleTargets)
+{
+    RenderTargetPool pool(renderer, 2);
+
+    pool.Acquire(8, 8);
+    RenderTargetPool::Lease held = pool.Acquire(16, 16);
+    EXPECT_EQ(pool.Size(), 2);
+
+    pool.EndFrame().EndFrame();
+    EXPECT_EQ(pool.Size(), 2);
+    pool.EndFrame();
+    // the idle target has sat out more than two frames, the leased one stays
+    EXPECT_EQ(pool.Size(), 1);
+    EXPECT_EQ(pool.Evictions(), 1u);
+
+    held.Release();
+    pool.Trim();
+    EXPECT_EQ(pool.Size(), 0);
+    EXPECT_EQ(pool.Evictions(), 2u);
+}
+
+TEST_F(SDL2wrapperRenderTargetPoolTest, PooledTargetsCanBeRenderedTo)
+{
+    RenderTargetPool pool(renderer);
+    RenderTargetPool::Lease lease = pool.Acquire(16, 16);
+
+    renderer.Target(*lease);
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.Clear();
+    renderer.Target();
+
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.Copy(*lease, std::nullopt, Rect(0, 0, 16, 16));
+
+    EXPECT_EQ(Pixel(8, 8), 0xFFFF0000u);
+}
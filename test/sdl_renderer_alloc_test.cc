@@ -0,0 +1,84 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Point.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+
+#include "test/sdl_software_renderer.h"
+
+namespace
+{
+
+std::atomic<long> allocations{0};
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+using namespace sdl2;
+
+class SDL2wrapperRendererAllocTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperRendererAllocTest() :
+        SDL2wrapperSoftwareRendererTest(256, 256)
+    {
+        for (int i = 0; i < 10000; ++i)
+        {
+            points.emplace_back(i % 256, i / 256);
+            rects.emplace_back(i % 256, i / 256, 4, 4);
+        }
+    }
+
+    std::vector<Point> points;
+    std::vector<Rect> rects;
+};
+
+TEST_F(SDL2wrapperRendererAllocTest, ArrayDrawsDoNotAllocate)
+{
+    long before = allocations;
+
+    renderer.DrawPoints(points.data(), static_cast<int>(points.size()));
+    renderer.DrawPoints(points);
+    renderer.DrawLines(points.data(), static_cast<int>(points.size()));
+    renderer.DrawLines(points);
+    renderer.DrawRects(rects.data(), static_cast<int>(rects.size()));
+    renderer.DrawRects(rects);
+    renderer.FillRects(rects.data(), static_cast<int>(rects.size()));
+    renderer.FillRects(rects);
+
+    EXPECT_EQ(allocations - before, 0);
+}
+
+TEST_F(SDL2wrapperRendererAllocTest, SurfaceFillRectsDoesNotAllocate)
+{
+    long before = allocations;
+
+    target.FillRects(rects.data(), static_cast<int>(rects.size()), 0xFF00FF00);
+    target.FillRects(rects, 0xFF00FF00);
+
+    EXPECT_EQ(allocations - before, 0);
+}
@@ -0,0 +1,300 @@
+#include <cstring>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/SDL2wrapper.h"
+
+using namespace sdl2;
+
+// Renderer and Texture operations on the software renderer of a hidden
+// dummy-driver window. Every iteration ends with SDL_RenderFlush so the
+// measured time includes the rendering SDL queues up. The BUILD target
+// prints JSON; pass --benchmark_format=console for a table.
+
+namespace
+{
+
+constexpr int kTargetSize = 1024;
+
+constexpr Uint32 kFormats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_RGB565,
+};
+constexpr int kFormatCount = sizeof(kFormats) / sizeof(kFormats[0]);
+
+// one window and renderer for the whole run
+struct Context
+{
+    Context() :
+        sdl(SDL_INIT_VIDEO),
+        window("sdl2wrapper-renderer-bench", 0, 0, kTargetSize, kTargetSize, SDL_WINDOW_HIDDEN),
+        renderer(window, -1, SDL_RENDERER_SOFTWARE)
+    {}
+
+    SDL sdl;
+    Window window;
+    Renderer renderer;
+};
+
+Renderer& GetRenderer()
+{
+    static Context* context = [] {
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+        return new Context();
+    }();
+    return context->renderer;
+}
+
+Uint32 Format(const benchmark::State& state)
+{
+    return kFormats[state.range(0)];
+}
+
+Texture MakeTexture(benchmark::State& state, int access, int size)
+{
+    Renderer& renderer = GetRenderer();
+    state.SetLabel(SDL_GetPixelFormatName(Format(state)));
+    Texture texture = CreateTexture(renderer, Format(state), access, size, size);
+
+    if (access != SDL_TEXTUREACCESS_TARGET)
+    {
+        const int bpp = SDL_BYTESPERPIXEL(Format(state));
+        std::vector<Uint8> pixels(static_cast<size_t>(size) * size * bpp);
+        for (size_t i = 0; i < pixels.size(); ++i)
+            pixels[i] = static_cast<Uint8>(i * 31);
+        texture.Update(std::nullopt, pixels.data(), size * bpp);
+    }
+    return texture;
+}
+
+void Flush(Renderer& renderer)
+{
+    SDL_RenderFlush(renderer.Get());
+}
+
+// spread over the target without falling off it
+Point Position(int i, int size)
+{
+    const int span = kTargetSize - size;
+    return Point((i * 97) % span, (i * 61) % span);
+}
+
+void FormatsAndBatches(benchmark::internal::Benchmark* bench)
+{
+    for (int format = 0; format < kFormatCount; ++format)
+        for (int batch : {1, 64, 4096})
+            bench->Args({format, batch});
+}
+
+void FormatsAndSizes(benchmark::internal::Benchmark* bench)
+{
+    for (int format = 0; format < kFormatCount; ++format)
+        for (int size : {64, 256, 1024})
+            bench->Args({format, size});
+}
+
+void Batches(benchmark::internal::Benchmark* bench)
+{
+    for (int batch : {1, 64, 4096, 65536})
+        bench->Arg(batch);
+}
+
+} // namespace
+
+// args: format, copies per iteration
+static void BM_CopyRects(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    Texture texture = MakeTexture(state, SDL_TEXTUREACCESS_STATIC, 32);
+    const int batch = static_cast<int>(state.range(1));
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < batch; ++i)
+            renderer.Copy(texture, Rect(0, 0, 32, 32), Rect(Position(i, 32), Point(32, 32)));
+        Flush(renderer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_CopyRects)->Apply(FormatsAndBatches);
+
+// whole texture stretched over the whole target
+static void BM_CopyFull(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    Texture texture = MakeTexture(state, SDL_TEXTUREACCESS_STATIC, 256);
+    const int batch = static_cast<int>(state.range(1));
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < batch; ++i)
+            renderer.Copy(texture);
+        Flush(renderer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_CopyFull)->Args({0, 1})->Args({1, 1})->Args({2, 1})->Args({3, 1})->Args({0, 16});
+
+static void BM_CopyRotated(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    Texture texture = MakeTexture(state, SDL_TEXTUREACCESS_STATIC, 32);
+    const int batch = static_cast<int>(state.range(1));
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < batch; ++i)
+            renderer.Copy(texture, std::nullopt, Rect(Position(i, 48), Point(32, 32)), 30.0);
+        Flush(renderer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_CopyRotated)->Apply(FormatsAndBatches);
+
+// args: format, tile size
+static void BM_FillCopy(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    const int tile = static_cast<int>(state.range(1));
+    Texture texture = MakeTexture(state, SDL_TEXTUREACCESS_STATIC, tile);
+
+    for (auto _ : state)
+    {
+        renderer.FillCopy(texture, std::nullopt, Rect(0, 0, kTargetSize, kTargetSize));
+        Flush(renderer);
+    }
+
+    const int tiles = (kTargetSize / tile) * (kTargetSize / tile);
+    state.SetItemsProcessed(state.iterations() * tiles);
+}
+BENCHMARK(BM_FillCopy)->Args({0, 16})->Args({0, 64})->Args({1, 16})->Args({2, 16})->Args({3, 16});
+
+static void BM_DrawPoints(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    std::vector<Point> points;
+    for (int i = 0; i < state.range(0); ++i)
+        points.push_back(Position(i, 1));
+
+    for (auto _ : state)
+    {
+        renderer.DrawPoints(points);
+        Flush(renderer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DrawPoints)->Apply(Batches);
+
+static void BM_DrawLines(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    std::vector<Point> points;
+    for (int i = 0; i < state.range(0) + 1; ++i)
+        points.push_back(Position(i, 1));
+
+    for (auto _ : state)
+    {
+        renderer.DrawLines(points);
+        Flush(renderer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DrawLines)->Apply(Batches);
+
+static void BM_FillRects(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    std::vector<Rect> rects;
+    for (int i = 0; i < state.range(0); ++i)
+        rects.emplace_back(Position(i, 16), Point(16, 16));
+
+    for (auto _ : state)
+    {
+        renderer.FillRects(rects);
+        Flush(renderer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FillRects)->Apply(Batches);
+
+// args: format, edge of the square read back
+static void BM_ReadPixels(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    const int size = static_cast<int>(state.range(1));
+    const int pitch = size * SDL_BYTESPERPIXEL(Format(state));
+    std::vector<Uint8> pixels(static_cast<size_t>(pitch) * size);
+    state.SetLabel(SDL_GetPixelFormatName(Format(state)));
+
+    for (auto _ : state)
+        renderer.ReadPixels(Rect(0, 0, size, size), Format(state), pixels.data(), pitch);
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(pixels.size()));
+}
+BENCHMARK(BM_ReadPixels)->Apply(FormatsAndSizes);
+
+static void BM_TextureUpdate(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(1));
+    Texture texture = MakeTexture(state, SDL_TEXTUREACCESS_STREAMING, size);
+    const int pitch = size * SDL_BYTESPERPIXEL(Format(state));
+    std::vector<Uint8> pixels(static_cast<size_t>(pitch) * size, 0x5A);
+
+    for (auto _ : state)
+        texture.Update(std::nullopt, pixels.data(), pitch);
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(pixels.size()));
+}
+BENCHMARK(BM_TextureUpdate)->Apply(FormatsAndSizes);
+
+// lock, write every row, unlock
+static void BM_TextureLock(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(1));
+    Texture texture = MakeTexture(state, SDL_TEXTUREACCESS_STREAMING, size);
+    const int row = size * SDL_BYTESPERPIXEL(Format(state));
+
+    for (auto _ : state)
+    {
+        Texture::LockHandle lock = texture.Lock();
+        Uint8* pixels = static_cast<Uint8*>(lock.Pixels());
+        for (int y = 0; y < size; ++y)
+            std::memset(pixels + y * lock.Pitch(), 0x5A, row);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(row) * size);
+}
+BENCHMARK(BM_TextureLock)->Apply(FormatsAndSizes);
+
+// args: access, edge of the patch; the patch comes from a 4096x4096
+// surface of another format, so the cost should follow the patch alone
+static void BM_TextureUpdateSurface(benchmark::State& state)
+{
+    Renderer& renderer = GetRenderer();
+    const int access = static_cast<int>(state.range(0));
+    const int size = static_cast<int>(state.range(1));
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, access, 512, 512);
+    Surface source(0, 4096, 4096, 32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000);
+    source.FillRect(std::nullopt, 0xFF336699);
+    state.SetLabel(access == SDL_TEXTUREACCESS_STREAMING ? "streaming" : "static");
+
+    for (auto _ : state)
+        texture.Update(Rect(0, 0, size, size), source);
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(BM_TextureUpdateSurface)
+    ->Args({SDL_TEXTUREACCESS_STATIC, 64})
+    ->Args({SDL_TEXTUREACCESS_STATIC, 512})
+    ->Args({SDL_TEXTUREACCESS_STREAMING, 64})
+    ->Args({SDL_TEXTUREACCESS_STREAMING, 512});
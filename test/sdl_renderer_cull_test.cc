@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/FPoint.h"
+#include "SDL2wrapper/include/FRect.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/SDL.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+#include "SDL2wrapper/include/Window.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperRendererCullTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperRendererCullTest() :
+        texture(CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 1, 1))
+    {
+        Uint32 texel = 0xFF0000FFu;
+        texture.Update(std::nullopt, &texel, sizeof(texel));
+
+        renderer.SetDrawColor(0, 0, 0);
+        renderer.Clear();
+        renderer.Present();
+        renderer.Cull(true);
+    }
+
+    Texture texture;
+};
+
+TEST_F(SDL2wrapperRendererCullTest, VisibleDrawsAreSubmitted)
+{
+    EXPECT_TRUE(renderer.Cull());
+
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.FillRect(Rect(-8, -8, 12, 12));
+    renderer.Copy(texture, std::nullopt, Rect(60, 60, 8, 8));
+
+    EXPECT_EQ(Pixel(0, 0), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(63, 63), 0xFF0000FFu);
+    EXPECT_EQ(renderer.Stats().submitted, 2u);
+    EXPECT_EQ(renderer.Stats().culled, 0u);
+}
+
+TEST_F(SDL2wrapperRendererCullTest, OffscreenDrawsAreCulled)
+{
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.FillRect(Rect(64, 0, 8, 8));
+    renderer.FillRect(FRect(-8.5f, 0, 8.5f, 8));
+    renderer.DrawRect(Rect(0, -10, 8, 10));
+    renderer.Copy(texture, std::nullopt, Rect(100, 100, 8, 8));
+    renderer.Copy(texture, std::nullopt, FRect(0, 64, 8, 8));
+
+    EXPECT_EQ(Pixel(0, 0), 0xFF000000u);
+    EXPECT_EQ(Pixel(63, 0), 0xFF000000u);
+    EXPECT_EQ(renderer.Stats().culled, 5u);
+    EXPECT_EQ(renderer.Stats().submitted, 0u);
+}
+
+TEST_F(SDL2wrapperRendererCullTest, ClipRectIsHonoured)
+{
+    renderer.ClipRect(Rect(16, 16, 16, 16));
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.FillRect(Rect(0, 0, 16, 16));
+    renderer.FillRect(Rect(8, 8, 16, 16));
+    renderer.ClipRect(std::nullopt);
+
+    EXPECT_EQ(Pixel(10, 10), 0xFF000000u);
+    EXPECT_EQ(Pixel(20, 20), 0xFFFF0000u);
+    EXPECT_EQ(renderer.Stats().culled, 1u);
+    EXPECT_EQ(renderer.Stats().submitted, 1u);
+}
+
+TEST_F(SDL2wrapperRendererCullTest, RotatedCopiesUseRotatedBounds)
+{
+    // off to the right, swung back into view around its left edge
+    renderer.Copy(texture, std::nullopt, FRect(64, 30, 32, 4), 180.0, FPoint(0, 2));
+
+    EXPECT_EQ(Pixel(48, 32), 0xFF0000FFu);
+    EXPECT_EQ(renderer.Stats().culled, 0u);
+}
+
+TEST_F(SDL2wrapperRendererCullTest, DeferredDrawsAreCulledBeforeRecording)
+{
+    renderer.Deferred(true);
+    renderer.Copy(texture, std::nullopt, Rect(-20, 0, 8, 8));
+    renderer.Copy(texture, std::nullopt, Rect(0, 0, 8, 8));
+    renderer.Flush();
+
+    EXPECT_EQ(Pixel(4, 4), 0xFF0000FFu);
+    EXPECT_EQ(renderer.Stats().culled, 1u);
+    EXPECT_EQ(renderer.Stats().submitted, 1u);
+}
+
+TEST_F(SDL2wrapperRendererCullTest, DisabledCullingSubmitsEverything)
+{
+    renderer.Cull(false);
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.FillRect(Rect(64, 0, 8, 8));
+
+    EXPECT_EQ(renderer.Stats().culled, 0u);
+    EXPECT_EQ(renderer.Stats().submitted, 0u);
+}
+
+TEST_F(SDL2wrapperRendererCullTest, CountsResetOnPresent)
+{
+    renderer.FillRect(Rect(64, 0, 8, 8));
+    renderer.FillRect(Rect(0, 0, 8, 8));
+    renderer.Present();
+
+    EXPECT_EQ(renderer.FrameStats().culled, 1u);
+    EXPECT_EQ(renderer.FrameStats().submitted, 1u);
+    EXPECT_EQ(renderer.Stats().culled, 0u);
+    EXPECT_EQ(renderer.Stats().submitted, 0u);
+}
+
+// a renderer made from a window starts with culling off
+TEST(SDL2wrapperRendererCullWindowTest, WindowRendererCullsOnlyWhenEnabled)
+{
+    SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+    SDL sdl(SDL_INIT_VIDEO);
+    Window window("cull", 0, 0, 64, 64, SDL_WINDOW_HIDDEN);
+    Renderer renderer(window, -1, SDL_RENDERER_SOFTWARE);
+
+    EXPECT_FALSE(renderer.Cull());
+    renderer.FillRect(Rect(64, 0, 8, 8));
+    EXPECT_EQ(renderer.Stats().culled, 0u);
+    EXPECT_EQ(renderer.Stats().submitted, 0u);
+
+    renderer.Cull(true);
+    renderer.FillRect(Rect(64, 0, 8, 8));
+    renderer.FillRect(Rect(0, 0, 8, 8));
+    EXPECT_EQ(renderer.Stats().culled, 1u);
+    EXPECT_EQ(renderer.Stats().submitted, 1u);
+}
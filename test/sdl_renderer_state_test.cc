@@ -0,0 +1,81 @@
+#include <optional>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/SDL.h"
+#include "SDL2wrapper/include/Texture.h"
+#include "SDL2wrapper/include/Window.h"
+
+using namespace sdl2;
+
+// The mirrored render state against changes SDL makes on its own
+class SDL2wrapperRendererStateTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+        sdl = new SDL(SDL_INIT_VIDEO);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete sdl;
+        sdl = nullptr;
+    }
+
+    static SDL* sdl;
+};
+
+SDL* SDL2wrapperRendererStateTest::sdl = nullptr;
+
+TEST_F(SDL2wrapperRendererStateTest, DestroyedTargetIsForgotten)
+{
+    Window window("state", 0, 0, 64, 64, SDL_WINDOW_HIDDEN);
+    Renderer renderer(window, -1, SDL_RENDERER_SOFTWARE);
+
+    std::optional<Texture> first(CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 8, 8));
+    renderer.Target(*first);
+    EXPECT_EQ(renderer.Viewport(), Rect(0, 0, 8, 8));
+
+    // SDL falls back to the default target on its own
+    first.reset();
+    Texture second = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 16, 16);
+    renderer.Target(second);
+    EXPECT_EQ(SDL_GetRenderTarget(renderer.Get()), second.Get());
+    EXPECT_EQ(renderer.Viewport(), Rect(0, 0, 16, 16));
+
+    renderer.SetDrawColor(255, 0, 0);
+    renderer.Clear();
+    Uint32 pixel = 0;
+    renderer.ReadPixels(Rect(15, 15, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+    EXPECT_EQ(pixel, 0xFFFF0000u);
+
+    renderer.Target();
+    EXPECT_EQ(SDL_GetRenderTarget(renderer.Get()), nullptr);
+    EXPECT_EQ(renderer.Viewport(), Rect(0, 0, 64, 64));
+}
+
+TEST_F(SDL2wrapperRendererStateTest, ResizeUpdatesViewportWithoutResync)
+{
+    Window window("state", 0, 0, 64, 64, SDL_WINDOW_HIDDEN);
+    Renderer renderer(window, -1, SDL_RENDERER_SOFTWARE);
+    renderer.Cull(true);
+    EXPECT_EQ(renderer.Viewport(), Rect(0, 0, 64, 64));
+
+    SDL_SetWindowSize(window.Get(), 128, 96);
+    renderer.Clear();
+    EXPECT_EQ(renderer.Viewport(), Rect(0, 0, 128, 96));
+
+    // the newly exposed area is not culled
+    renderer.FillRect(Rect(100, 80, 8, 8));
+    EXPECT_EQ(renderer.Stats().culled, 0u);
+    EXPECT_EQ(renderer.Stats().submitted, 1u);
+
+    SDL_SetWindowSize(window.Get(), 32, 32);
+    renderer.Present();
+    EXPECT_EQ(renderer.Viewport(), Rect(0, 0, 32, 32));
+}
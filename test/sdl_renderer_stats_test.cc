@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/RendererStats.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+#ifndef SDL2WRAPPER_STATS
+#error "build against //:sdl2wrapper-stats"
+#endif
+
+using namespace sdl2;
+
+class SDL2wrapperRendererStatsTest : public SDL2wrapperSoftwareRendererTest
+{
+};
+
+TEST_F(SDL2wrapperRendererStatsTest, CountsDrawCallsPerFrame)
+{
+    renderer.Present();
+    renderer.SetDrawColor(10, 20, 30);
+    renderer.SetDrawColor(10, 20, 30);
+    renderer.FillRect(Rect(0, 0, 10, 10));
+    renderer.DrawLine(0, 0, 10, 10);
+    renderer.Clear();
+
+    EXPECT_EQ(renderer.Stats().state_changes, 1u);
+    EXPECT_EQ(renderer.Stats().fills, 1u);
+    EXPECT_EQ(renderer.Stats().lines, 1u);
+    EXPECT_EQ(renderer.Stats().clears, 1u);
+
+    renderer.Present();
+    EXPECT_EQ(renderer.FrameStats().fills, 1u);
+    EXPECT_EQ(renderer.FrameStats().lines, 1u);
+    EXPECT_EQ(renderer.Stats().fills, 0u);
+    EXPECT_EQ(renderer.Stats().lines, 0u);
+}
+
+TEST_F(SDL2wrapperRendererStatsTest, CountsDeferredBatches)
+{
+    Texture first = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 4, 4);
+    Texture second = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 4, 4);
+    renderer.Present();
+
+    renderer.Deferred(true);
+    renderer.FillRect(Rect(0, 0, 8, 8));
+    renderer.FillRect(Rect(16, 0, 8, 8));
+    renderer.Copy(first, std::nullopt, Rect(0, 16, 4, 4));
+    renderer.Copy(second, std::nullopt, Rect(8, 16, 4, 4));
+    renderer.Flush();
+
+    // one batch for both fills, one per texture; four vertices a quad
+    EXPECT_EQ(renderer.Stats().geometry, 3u);
+    EXPECT_EQ(renderer.Stats().vertices, 16u);
+    EXPECT_EQ(renderer.Stats().texture_switches, 2u);
+    EXPECT_EQ(renderer.Stats().fills, 0u);
+    EXPECT_EQ(renderer.Stats().copies, 0u);
+}
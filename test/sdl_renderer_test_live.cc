@@ -55,6 +55,13 @@ TEST(SDL2WrapperRendererTest, ComplexTest)
         renderer.GetDrawColor(r, g, b, a);
         EXPECT_TRUE(r == 1 && g == 2 && b == 3 && a == 255);
 
+        // state is mirrored until resynced from SDL
+        SDL_SetRenderDrawColor(renderer.Get(), 4, 5, 6, 7);
+        EXPECT_EQ(renderer.GetDrawColor(), Color(1, 2, 3, 255));
+        renderer.Resync();
+        EXPECT_EQ(renderer.GetDrawColor(), Color(4, 5, 6, 7));
+
+        renderer.SetDrawColor(1, 2, 3);
         renderer.Clear();
 
         renderer.Present();
@@ -183,6 +190,163 @@ TEST(SDL2WrapperRendererTest, ComplexTest)
         SDL_Delay(1000);
     }
 
+    {
+        // Deferred drawing
+        renderer.SetDrawColor(0, 0, 0);
+        renderer.Clear();
+
+        renderer.Deferred(true);
+        EXPECT_TRUE(renderer.Deferred());
+
+        renderer.SetDrawColor(255, 0, 0);
+        renderer.FillRect(Rect(10, 10, 20, 20));
+        renderer.SetDrawColor(0, 255, 0);
+        renderer.FillRect(Rect(20, 20, 20, 20));
+        renderer.SetDrawColor(255, 0, 0);
+        renderer.FillRect(Rect(60, 10, 20, 20));
+
+        renderer.Layer(-1);
+        renderer.SetDrawColor(0, 0, 255);
+        renderer.FillRect(Rect(0, 0, 100, 100));
+        renderer.Layer(0);
+
+        renderer.Flush();
+
+        // overlapping quads keep submission order, lower layers go below
+        Uint32 pixel;
+        renderer.ReadPixels(Rect(25, 25, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFF00FF00u);
+        renderer.ReadPixels(Rect(65, 15, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFFFF0000u);
+        renderer.ReadPixels(Rect(5, 5, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFF0000FFu);
+
+        renderer.Deferred(false);
+        EXPECT_FALSE(renderer.Deferred());
+
+        renderer.Present();
+        SDL_Delay(1000);
+    }
+
+#ifdef SDL2WRAPPER_STATS
+    {
+        // Per-frame stats
+        renderer.Present();
+        renderer.SetDrawColor(10, 20, 30);
+        renderer.SetDrawColor(10, 20, 30);
+        renderer.FillRect(Rect(0, 0, 10, 10));
+        renderer.DrawLine(0, 0, 10, 10);
+
+        EXPECT_EQ(renderer.Stats().state_changes, 1u);
+        EXPECT_EQ(renderer.Stats().fills, 1u);
+        EXPECT_EQ(renderer.Stats().lines, 1u);
+
+        renderer.Present();
+        EXPECT_EQ(renderer.FrameStats().fills, 1u);
+        EXPECT_EQ(renderer.Stats().fills, 0u);
+    }
+#endif
+
+    {
+        // Sprite batches
+        Texture sprites = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 2, 1);
+        Uint32 texels[] = { 0xFFFF0000u, 0xFF0000FFu };
+        sprites.Update(std::nullopt, texels, sizeof(texels));
+
+        renderer.SetDrawColor(0, 0, 0);
+        renderer.Clear();
+
+        CopyCommand commands[] = {
+            { Rect(0, 0, 1, 1), Rect(0, 0, 10, 10) },
+            { Rect(1, 0, 1, 1), Rect(10, 0, 10, 10) },
+            { Rect(0, 0, 1, 1), Rect(20, 0, 10, 10) },
+        };
+        renderer.CopyBatch(sprites, commands, 3);
+
+        Uint32 pixel;
+        renderer.ReadPixels(Rect(15, 5, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFF0000FFu);
+        renderer.ReadPixels(Rect(25, 5, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFFFF0000u);
+
+        SpriteBatch batch(sprites);
+        batch.Add(commands, 3);
+        EXPECT_EQ(batch.Size(), 3);
+        EXPECT_EQ(batch.VertexCount(), 12);
+        EXPECT_EQ(batch.IndexCount(), 18);
+
+        batch.Clear();
+        EXPECT_TRUE(batch.Empty());
+        batch.Add(Rect(1, 0, 1, 1), Rect(0, 0, 10, 10));
+        renderer.Draw(batch);
+
+        renderer.ReadPixels(Rect(5, 5, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFF0000FFu);
+
+        renderer.Present();
+        SDL_Delay(1000);
+    }
+
+    {
+        // Float coordinates
+        renderer.SetDrawColor(0, 0, 0);
+        renderer.Clear();
+
+        renderer.SetDrawColor(255, 0, 0);
+        renderer.FillRect(FRect(0.5f, 0.5f, 9.0f, 9.0f));
+        renderer.DrawRect(FRect(20.25f, 20.25f, 10.0f, 10.0f));
+        renderer.DrawLine(FPoint(40.5f, 40.5f), FPoint(60.5f, 45.5f));
+        renderer.DrawPoint(FPoint(70.5f, 70.5f));
+
+        std::vector<FPoint> points = {FPoint(80.0f, 80.0f), FPoint(90.5f, 85.5f), FPoint(100.0f, 80.0f)};
+        renderer.DrawPoints(points);
+        renderer.DrawLines(points);
+
+        Uint32 pixel = 0;
+        renderer.ReadPixels(Rect(5, 5, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFFFF0000u);
+
+        Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 2, 1);
+        Uint32 texels[2] = {0xFF00FF00u, 0xFF0000FFu};
+        texture.Update(std::nullopt, texels, 8);
+
+        renderer.Copy(texture, Rect(0, 0, 1, 1), FRect(10.5f, 0.5f, 10.0f, 10.0f));
+        renderer.Copy(texture, Rect(1, 0, 1, 1), FPoint(30.5f, 0.5f));
+        renderer.Copy(texture, std::nullopt, FRect(40.0f, 0.0f, 10.0f, 10.0f), 90.0, FPoint(5.0f, 5.0f), SDL_FLIP_HORIZONTAL);
+
+        renderer.ReadPixels(Rect(15, 5, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFF00FF00u);
+
+        // untextured geometry, with and without indices
+        const SDL_Color blue = {0, 0, 255, 255};
+        std::vector<SDL_Vertex> vertices = {
+            {{0.0f, 100.0f}, blue, {0.0f, 0.0f}},
+            {{20.0f, 100.0f}, blue, {0.0f, 0.0f}},
+            {{20.0f, 120.0f}, blue, {0.0f, 0.0f}},
+            {{0.0f, 120.0f}, blue, {0.0f, 0.0f}},
+        };
+        renderer.Geometry(nullptr, vertices, {0, 1, 2, 0, 2, 3});
+        renderer.Geometry(nullptr, vertices.data(), 3);
+
+        renderer.ReadPixels(Rect(5, 115, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFF0000FFu);
+
+        // float copies are deferred like integer ones
+        renderer.Deferred(true);
+        renderer.Copy(texture, Rect(0, 0, 1, 1), FRect(0.5f, 130.5f, 10.0f, 10.0f));
+        renderer.FillRect(FRect(20.5f, 130.5f, 10.0f, 10.0f));
+        EXPECT_TRUE(renderer.TryFlush());
+        renderer.Deferred(false);
+
+        renderer.ReadPixels(Rect(5, 135, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFF00FF00u);
+        renderer.ReadPixels(Rect(25, 135, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        EXPECT_EQ(pixel, 0xFFFF0000u);
+
+        renderer.Present();
+        SDL_Delay(1000);
+    }
+
     if (renderer.TargetSupported()) {
         // Render target
         Texture target = CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, 32, 32);
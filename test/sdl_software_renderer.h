@@ -0,0 +1,52 @@
+#ifndef SDL2WRAPPER_TEST_SDL_SOFTWARE_RENDERER_H_
+#define SDL2WRAPPER_TEST_SDL_SOFTWARE_RENDERER_H_
+
+#include <optional>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+
+// A Renderer drawing into an ARGB8888 surface, so tests need no display.
+// List this header in the test's srcs.
+struct SDL2wrapperSoftwareRenderer
+{
+    explicit SDL2wrapperSoftwareRenderer(int w = 64, int h = 64) :
+        target(0, w, h, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000),
+        renderer(SDL_CreateSoftwareRenderer(target.Get()))
+    {}
+
+    // an ARGB8888 surface filled with color
+    static sdl2::Surface Sprite(int w, int h, Uint32 color)
+    {
+        sdl2::Surface surface(0, w, h, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+        surface.FillRect(std::nullopt, color);
+        return surface;
+    }
+
+    // ARGB8888 at (x, y) of the target
+    Uint32 Pixel(int x, int y)
+    {
+        Uint32 pixel = 0;
+        renderer.ReadPixels(sdl2::Rect(x, y, 1, 1), SDL_PIXELFORMAT_ARGB8888, &pixel, 4);
+        return pixel;
+    }
+
+    sdl2::Surface target;
+    sdl2::Renderer renderer;
+};
+
+// Parameterized tests derive from ::testing::TestWithParam and
+// SDL2wrapperSoftwareRenderer themselves.
+class SDL2wrapperSoftwareRendererTest : public ::testing::Test, protected SDL2wrapperSoftwareRenderer
+{
+protected:
+    explicit SDL2wrapperSoftwareRendererTest(int w = 64, int h = 64) :
+        SDL2wrapperSoftwareRenderer(w, h)
+    {}
+};
+
+#endif
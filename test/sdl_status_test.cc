@@ -0,0 +1,128 @@
+#include <string>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Exception.h"
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Status.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+TEST(SDL2wrapperStatusTest, DefaultIsOk)
+{
+    constexpr Status status;
+    static_assert(status.Ok());
+    EXPECT_TRUE(static_cast<bool>(status));
+    EXPECT_EQ(status.Function(), nullptr);
+    EXPECT_STREQ(status.Error(), "");
+}
+
+TEST(SDL2wrapperStatusTest, FailureKeepsFunction)
+{
+    SDL_SetError("broken");
+    Status status("SDL_Foo");
+    EXPECT_FALSE(status.Ok());
+    EXPECT_FALSE(static_cast<bool>(status));
+    EXPECT_STREQ(status.Function(), "SDL_Foo");
+    EXPECT_STREQ(status.Error(), "broken");
+}
+
+TEST(SDL2wrapperStatusTest, ThrowIfFailed)
+{
+    EXPECT_NO_THROW(ThrowIfFailed(Status()));
+
+    SDL_SetError("broken");
+    try
+    {
+        ThrowIfFailed(Status("SDL_Foo"));
+        FAIL();
+    }
+    catch (const SDLException& e)
+    {
+        EXPECT_EQ(e.SDLFunction(), "SDL_Foo");
+        EXPECT_EQ(e.SDLError(), "broken");
+        EXPECT_STREQ(e.what(), "SDL_Foo failed: broken");
+    }
+}
+
+TEST(SDL2wrapperStatusTest, ExceptionOwnsFunctionName)
+{
+    SDL_SetError("broken");
+    std::string function = "SDL_Bar";
+    SDLException e(function.c_str());
+    function.assign(64, 'x');
+
+    EXPECT_EQ(e.SDLFunction(), "SDL_Bar");
+    EXPECT_EQ(e.SDLError(), "broken");
+}
+
+class SDL2wrapperTryTest : public SDL2wrapperSoftwareRendererTest
+{
+};
+
+TEST_F(SDL2wrapperTryTest, RendererDraws)
+{
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    Rect rects[2] = {Rect(0, 0, 4, 4), Rect(8, 8, 4, 4)};
+    Rect dst(16, 16, 8, 8);
+
+    EXPECT_TRUE(renderer.TrySetDrawColor(Color(255, 0, 0)));
+    EXPECT_TRUE(renderer.TryClear());
+    EXPECT_TRUE(renderer.TryFillRect(rects[0]));
+    EXPECT_TRUE(renderer.TryFillRects(rects, 2));
+    EXPECT_TRUE(renderer.TryDrawRects(rects, 2));
+    EXPECT_TRUE(renderer.TryCopy(texture, nullptr, &dst));
+    EXPECT_TRUE(renderer.TryCopy(texture, nullptr, &dst, 45.0, nullptr, SDL_FLIP_NONE));
+    EXPECT_TRUE(renderer.TryFlush());
+    EXPECT_EQ(renderer.GetDrawColor(), Color(255, 0, 0));
+}
+
+TEST_F(SDL2wrapperTryTest, TextureReportsFailure)
+{
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+
+    Status status = texture.TryUpdate(nullptr, nullptr, 32);
+    EXPECT_FALSE(status);
+    EXPECT_STREQ(status.Function(), "SDL_UpdateTexture");
+    EXPECT_THROW(texture.Update(std::nullopt, nullptr, 32), SDLException);
+
+    // only streaming textures can be locked
+    Texture::LockHandle handle;
+    status = texture.TryLock(handle);
+    EXPECT_FALSE(status);
+    EXPECT_STREQ(status.Function(), "SDL_LockTexture");
+    EXPECT_EQ(handle.Pixels(), nullptr);
+}
+
+TEST_F(SDL2wrapperTryTest, TextureLock)
+{
+    Texture texture = CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 8, 8);
+
+    Texture::LockHandle handle;
+    EXPECT_TRUE(texture.TryLock(handle));
+    EXPECT_NE(handle.Pixels(), nullptr);
+    EXPECT_EQ(handle.Pitch(), 8 * 4);
+}
+
+TEST_F(SDL2wrapperTryTest, Surface)
+{
+    Surface other(0, 16, 16, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    Rect rects[2] = {Rect(0, 0, 4, 4), Rect(8, 8, 4, 4)};
+    SDL_Rect dst = {4, 4, 0, 0};
+
+    EXPECT_TRUE(other.TryFillRect(nullptr, 0xFF00FF00));
+    EXPECT_TRUE(other.TryFillRects(rects, 2, 0xFFFF0000));
+    EXPECT_TRUE(other.TryBlit(nullptr, target, &dst));
+    EXPECT_EQ(dst.w, 16);
+    EXPECT_EQ(dst.h, 16);
+
+    Surface::LockHandle handle;
+    EXPECT_TRUE(target.TryLock(handle));
+    EXPECT_EQ(handle.Pixels(), target.Get()->pixels);
+}
@@ -0,0 +1,165 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/StreamingTexture.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperStreamingTextureTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperStreamingTextureTest() :
+        SDL2wrapperSoftwareRendererTest(4, 4)
+    {}
+
+    // fills the slot with opaque blue value
+    static void Fill(StreamingTexture::WriteHandle& slot, Uint8 value)
+    {
+        Uint32* pixels = static_cast<Uint32*>(slot.Pixels());
+        for (int i = 0; i < 4 * 4; ++i)
+            pixels[i] = 0xFF000000u | value;
+    }
+
+    Uint32 Shown(StreamingTexture& stream)
+    {
+        renderer.Copy(stream.Upload());
+        Surface::LockHandle lock = target.Lock();
+        return static_cast<const Uint32*>(lock.Pixels())[0];
+    }
+};
+
+TEST_F(SDL2wrapperStreamingTextureTest, UploadsPublishedSlot)
+{
+    StreamingTexture stream(renderer, SDL_PIXELFORMAT_ARGB8888, 4, 4);
+    EXPECT_EQ(stream.Slots(), 3);
+    EXPECT_EQ(stream.Pitch(), 16);
+
+    // nothing published yet
+    stream.Upload();
+    EXPECT_EQ(stream.Frame(), 0u);
+
+    {
+        StreamingTexture::WriteHandle slot = stream.Acquire();
+        ASSERT_TRUE(slot);
+        Fill(slot, 7);
+        // not published while the handle lives
+        stream.Upload();
+        EXPECT_EQ(stream.Frame(), 0u);
+    }
+    EXPECT_EQ(stream.Published(), 1u);
+    EXPECT_EQ(Shown(stream), 0xFF000007u);
+    EXPECT_EQ(stream.Frame(), 1u);
+
+    // nothing newer: the texture keeps its pixels
+    EXPECT_EQ(Shown(stream), 0xFF000007u);
+    EXPECT_EQ(stream.Frame(), 1u);
+}
+
+TEST_F(SDL2wrapperStreamingTextureTest, UploadsNewestAndFreesTheRest)
+{
+    StreamingTexture stream(renderer, SDL_PIXELFORMAT_ARGB8888, 4, 4);
+    for (Uint8 i = 1; i <= 3; ++i)
+    {
+        StreamingTexture::WriteHandle slot = stream.Acquire();
+        ASSERT_TRUE(slot);
+        Fill(slot, i);
+    }
+    EXPECT_EQ(Shown(stream), 0xFF000003u);
+    EXPECT_EQ(stream.Frame(), 3u);
+
+    // every slot is free again
+    std::vector<StreamingTexture::WriteHandle> slots;
+    for (int i = 0; i < 3; ++i)
+    {
+        slots.push_back(stream.Acquire());
+        EXPECT_TRUE(slots.back());
+    }
+}
+
+TEST_F(SDL2wrapperStreamingTextureTest, ReusesOldestPublishedSlot)
+{
+    StreamingTexture stream(renderer, SDL_PIXELFORMAT_ARGB8888, 4, 4);
+    {
+        StreamingTexture::WriteHandle first = stream.Acquire();
+        Fill(first, 1);
+        StreamingTexture::WriteHandle second = stream.Acquire();
+        Fill(second, 2);
+    }
+    StreamingTexture::WriteHandle writing = stream.Acquire();
+    ASSERT_TRUE(writing);
+
+    // no slot is free, so frame 1 is overwritten
+    {
+        StreamingTexture::WriteHandle slot = stream.Acquire();
+        ASSERT_TRUE(slot);
+        Fill(slot, 3);
+    }
+    EXPECT_EQ(Shown(stream), 0xFF000003u);
+    EXPECT_EQ(stream.Frame(), 3u);
+}
+
+TEST_F(SDL2wrapperStreamingTextureTest, EmptyHandleWhenNoSlotCanBeTaken)
+{
+    StreamingTexture stream(renderer, SDL_PIXELFORMAT_ARGB8888, 4, 4, 2);
+    {
+        StreamingTexture::WriteHandle slot = stream.Acquire();
+        Fill(slot, 1);
+    }
+    StreamingTexture::WriteHandle writing = stream.Acquire();
+    EXPECT_TRUE(writing);
+
+    // the only published frame is never overwritten
+    StreamingTexture::WriteHandle none = stream.Acquire();
+    EXPECT_FALSE(none);
+    EXPECT_EQ(none.Pixels(), nullptr);
+    EXPECT_EQ(Shown(stream), 0xFF000001u);
+}
+
+TEST_F(SDL2wrapperStreamingTextureTest, ProducerThreadNeverTearsFrames)
+{
+    StreamingTexture stream(renderer, SDL_PIXELFORMAT_ARGB8888, 4, 4);
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        for (int i = 1; i <= 2000; ++i)
+        {
+            StreamingTexture::WriteHandle slot = stream.Acquire();
+            if (slot)
+                Fill(slot, static_cast<Uint8>(i));
+            std::this_thread::yield();
+        }
+        done = true;
+    });
+
+    // checked after the join so a failure cannot leave the thread running
+    int backwards = 0;
+    int torn = 0;
+    Uint64 last = 0;
+    while (!done)
+    {
+        stream.Upload();
+        if (stream.Frame() < last)
+            ++backwards;
+        last = stream.Frame();
+
+        Texture::LockHandle lock = stream.Get().Lock();
+        const Uint32* pixels = static_cast<const Uint32*>(lock.Pixels());
+        for (int i = 1; i < 4 * 4; ++i)
+            if (pixels[i] != pixels[0])
+                ++torn;
+    }
+    producer.join();
+    EXPECT_EQ(backwards, 0);
+    EXPECT_EQ(torn, 0);
+
+    stream.Upload();
+    EXPECT_EQ(stream.Frame(), stream.Published());
+}
@@ -0,0 +1,239 @@
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/SDL2wrapper.h"
+
+using namespace sdl2;
+
+// CPU-side Surface operations. Every benchmark reports Mpix/s, the pixels
+// written per second, so per-pixel regressions stand out across sizes.
+
+namespace
+{
+
+constexpr Uint32 kFormats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_RGB24,
+    SDL_PIXELFORMAT_RGB565,
+};
+constexpr int kFormatCount = sizeof(kFormats) / sizeof(kFormats[0]);
+
+constexpr SDL_BlendMode kBlendModes[] = {
+    SDL_BLENDMODE_NONE,
+    SDL_BLENDMODE_BLEND,
+    SDL_BLENDMODE_ADD,
+};
+constexpr int kBlendModeCount = sizeof(kBlendModes) / sizeof(kBlendModes[0]);
+
+constexpr int kSizes[] = {32, 128, 512, 2048, 4096};
+
+const char* BlendName(SDL_BlendMode mode)
+{
+    switch (mode)
+    {
+    case SDL_BLENDMODE_BLEND:
+        return "blend";
+    case SDL_BLENDMODE_ADD:
+        return "add";
+    default:
+        return "none";
+    }
+}
+
+// w x h with a pattern that mixes colors and alpha, and a run of the
+// color key in every row
+Surface MakeSurface(Uint32 format, int w, int h)
+{
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, SDL_BITSPERPIXEL(format), format);
+    if (surface == nullptr)
+        ThrowSDLException("SDL_CreateRGBSurfaceWithFormat");
+    Surface result(surface);
+
+    std::vector<Rect> bands;
+    for (int x = 0; x < w; x += 8)
+        bands.emplace_back(x, 0, 4, h);
+    result.FillRect(std::nullopt, SDL_MapRGBA(surface->format, 200, 100, 50, 160));
+    result.FillRects(bands, SDL_MapRGBA(surface->format, 20, 220, 120, 255));
+    result.FillRect(Rect(0, 0, w / 4, h), SDL_MapRGBA(surface->format, 255, 0, 255, 0));
+    return result;
+}
+
+void SetPixelCounter(benchmark::State& state, Sint64 pixels_per_iteration)
+{
+    state.counters["Mpix/s"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * pixels_per_iteration) / 1e6,
+        benchmark::Counter::kIsRate
+    );
+}
+
+void Label(benchmark::State& state, Uint32 src, Uint32 dst, const char* extra = nullptr)
+{
+    std::string label = SDL_GetPixelFormatName(src);
+    label += " -> ";
+    label += SDL_GetPixelFormatName(dst);
+    if (extra != nullptr)
+    {
+        label += " ";
+        label += extra;
+    }
+    state.SetLabel(label.c_str());
+}
+
+// every format pair and blend mode at 512, and the sizes for a few pairs
+void BlitArgs(benchmark::internal::Benchmark* bench)
+{
+    for (int src = 0; src < kFormatCount; ++src)
+        for (int dst = 0; dst < kFormatCount; ++dst)
+            for (int blend = 0; blend < kBlendModeCount; ++blend)
+                bench->Args({src, dst, blend, 512});
+    for (int size : kSizes)
+        for (int dst : {0, 2})
+            for (int blend = 0; blend < kBlendModeCount; ++blend)
+                bench->Args({0, dst, blend, size});
+}
+
+void FormatPairArgs(benchmark::internal::Benchmark* bench)
+{
+    for (int src = 0; src < kFormatCount; ++src)
+        for (int dst = 0; dst < kFormatCount; ++dst)
+            bench->Args({src, dst, 512});
+    for (int size : kSizes)
+        bench->Args({0, 2, size});
+}
+
+void FormatSizeArgs(benchmark::internal::Benchmark* bench)
+{
+    for (int format = 0; format < kFormatCount; ++format)
+        for (int size : kSizes)
+            bench->Args({format, size});
+}
+
+// format, RLE off/on, size
+void ColorKeyArgs(benchmark::internal::Benchmark* bench)
+{
+    for (int format : {0, 2, 4})
+        for (int rle = 0; rle < 2; ++rle)
+            for (int size : kSizes)
+                bench->Args({format, rle, size});
+}
+
+} // namespace
+
+// args: src format, dst format, blend mode, size
+static void BM_Blit(benchmark::State& state)
+{
+    const Uint32 src_format = kFormats[state.range(0)];
+    const Uint32 dst_format = kFormats[state.range(1)];
+    const SDL_BlendMode blend = kBlendModes[state.range(2)];
+    const int size = static_cast<int>(state.range(3));
+
+    Surface src = MakeSurface(src_format, size, size);
+    Surface dst = MakeSurface(dst_format, size, size);
+    src.BlendMode(blend);
+    Label(state, src_format, dst_format, BlendName(blend));
+
+    for (auto _ : state)
+        src.Blit(std::nullopt, dst, Rect(0, 0, size, size));
+
+    SetPixelCounter(state, static_cast<Sint64>(size) * size);
+}
+BENCHMARK(BM_Blit)->Apply(BlitArgs);
+
+// args: src format, dst format, size; scales to 1.5 times the size
+static void BM_BlitScaled(benchmark::State& state)
+{
+    const Uint32 src_format = kFormats[state.range(0)];
+    const Uint32 dst_format = kFormats[state.range(1)];
+    const int size = static_cast<int>(state.range(2));
+    const int dst_size = size * 3 / 2;
+
+    Surface src = MakeSurface(src_format, size, size);
+    Surface dst = MakeSurface(dst_format, dst_size, dst_size);
+    src.BlendMode(SDL_BLENDMODE_NONE);
+    Label(state, src_format, dst_format);
+
+    for (auto _ : state)
+        src.BlitScaled(std::nullopt, dst, std::nullopt);
+
+    SetPixelCounter(state, static_cast<Sint64>(dst_size) * dst_size);
+}
+BENCHMARK(BM_BlitScaled)->Apply(FormatPairArgs);
+
+// args: src format, dst format, size
+static void BM_Convert(benchmark::State& state)
+{
+    const Uint32 src_format = kFormats[state.range(0)];
+    const Uint32 dst_format = kFormats[state.range(1)];
+    const int size = static_cast<int>(state.range(2));
+
+    Surface src = MakeSurface(src_format, size, size);
+    Label(state, src_format, dst_format);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(src.Convert(dst_format).Get());
+
+    SetPixelCounter(state, static_cast<Sint64>(size) * size);
+}
+BENCHMARK(BM_Convert)->Apply(FormatPairArgs);
+
+// args: format, RLE, size; color-keyed blit onto the same format
+static void BM_BlitColorKey(benchmark::State& state)
+{
+    const Uint32 format = kFormats[state.range(0)];
+    const bool rle = state.range(1) != 0;
+    const int size = static_cast<int>(state.range(2));
+
+    Surface src = MakeSurface(format, size, size);
+    Surface dst = MakeSurface(format, size, size);
+    src.BlendMode(SDL_BLENDMODE_NONE);
+    src.ColorKey(true, SDL_MapRGBA(src.Get()->format, 255, 0, 255, 0));
+    src.RLE(rle);
+    Label(state, format, format, rle ? "colorkey rle" : "colorkey");
+
+    for (auto _ : state)
+        src.Blit(std::nullopt, dst, Rect(0, 0, size, size));
+
+    SetPixelCounter(state, static_cast<Sint64>(size) * size);
+}
+BENCHMARK(BM_BlitColorKey)->Apply(ColorKeyArgs);
+
+// args: format, size
+static void BM_FillRect(benchmark::State& state)
+{
+    const Uint32 format = kFormats[state.range(0)];
+    const int size = static_cast<int>(state.range(1));
+
+    Surface surface = MakeSurface(format, size, size);
+    state.SetLabel(SDL_GetPixelFormatName(format));
+
+    for (auto _ : state)
+        surface.FillRect(std::nullopt, 0x12345678);
+
+    SetPixelCounter(state, static_cast<Sint64>(size) * size);
+}
+BENCHMARK(BM_FillRect)->Apply(FormatSizeArgs);
+
+// args: format, size; 16x16 rects tiling the whole surface
+static void BM_FillRects(benchmark::State& state)
+{
+    const Uint32 format = kFormats[state.range(0)];
+    const int size = static_cast<int>(state.range(1));
+
+    Surface surface = MakeSurface(format, size, size);
+    std::vector<Rect> rects;
+    for (int y = 0; y < size; y += 16)
+        for (int x = 0; x < size; x += 16)
+            rects.emplace_back(x, y, 16, 16);
+    state.SetLabel(SDL_GetPixelFormatName(format));
+
+    for (auto _ : state)
+        surface.FillRects(rects, 0x12345678);
+
+    SetPixelCounter(state, static_cast<Sint64>(size) * size);
+}
+BENCHMARK(BM_FillRects)->Apply(FormatSizeArgs);
@@ -0,0 +1,103 @@
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Rect.h"
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+#include "SDL2wrapper/include/TextureAtlas.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+class SDL2wrapperTextureAtlasTest : public SDL2wrapperSoftwareRendererTest
+{
+protected:
+    SDL2wrapperTextureAtlasTest() :
+        SDL2wrapperSoftwareRendererTest(256, 256)
+    {}
+};
+
+TEST_F(SDL2wrapperTextureAtlasTest, InsertAndDraw)
+{
+    TextureAtlas atlas(renderer, 64, 64);
+    Surface red = Sprite(16, 16, 0xFFFF0000);
+    Surface green = Sprite(8, 24, 0xFF00FF00);
+
+    std::optional<TextureAtlas::Region> a = atlas.Insert(red);
+    std::optional<TextureAtlas::Region> b = atlas.Insert(green);
+    ASSERT_TRUE(a);
+    ASSERT_TRUE(b);
+    EXPECT_EQ(atlas.PageCount(), 1);
+    EXPECT_EQ(a->page, 0);
+    EXPECT_EQ(a->rect.w, 16);
+    EXPECT_EQ(b->rect.h, 24);
+    // padding keeps regions apart
+    EXPECT_FALSE(a->rect.Extension(1).Intersects(b->rect));
+
+    renderer.SetDrawColor(0, 0, 0);
+    renderer.Clear();
+    renderer.Copy(atlas.Page(*a), a->rect, Rect(0, 0, 16, 16));
+    renderer.Copy(atlas.Page(*b), b->rect, Rect(32, 0, 8, 24));
+    EXPECT_EQ(Pixel(8, 8), 0xFFFF0000u);
+    EXPECT_EQ(Pixel(35, 20), 0xFF00FF00u);
+}
+
+TEST_F(SDL2wrapperTextureAtlasTest, IncrementalInsertionKeepsRegions)
+{
+    TextureAtlas atlas(renderer, 64, 64, 0);
+    Surface sprite = Sprite(32, 32, 0xFFFF0000);
+
+    std::vector<TextureAtlas::Region> regions;
+    for (int i = 0; i < 4; ++i)
+        regions.push_back(*atlas.Insert(sprite));
+    EXPECT_EQ(atlas.PageCount(), 1);
+    EXPECT_DOUBLE_EQ(atlas.Occupancy(0), 1.0);
+
+    Texture& first_page = atlas.Page(0);
+
+    // a full page is left alone and a new one is started
+    std::optional<TextureAtlas::Region> late = atlas.Insert(sprite);
+    ASSERT_TRUE(late);
+    EXPECT_EQ(late->page, 1);
+    EXPECT_EQ(atlas.PageCount(), 2);
+    EXPECT_EQ(&atlas.Page(0), &first_page);
+
+    for (int i = 0; i < 4; ++i)
+        for (int j = i + 1; j < 4; ++j)
+            EXPECT_FALSE(regions[i].rect.Intersects(regions[j].rect));
+}
+
+TEST_F(SDL2wrapperTextureAtlasTest, RejectsOversizedSurfaces)
+{
+    TextureAtlas atlas(renderer, 32, 32);
+    Surface big = Sprite(33, 8, 0xFFFF0000);
+    EXPECT_FALSE(atlas.Insert(big));
+    EXPECT_EQ(atlas.PageCount(), 0);
+
+    // a surface as large as the page fits despite the padding
+    Surface exact = Sprite(32, 32, 0xFFFF0000);
+    EXPECT_TRUE(atlas.Insert(exact));
+}
+
+TEST_F(SDL2wrapperTextureAtlasTest, BatchInsertKeepsOrder)
+{
+    TextureAtlas atlas(renderer, 64, 64, 0);
+    Surface small = Sprite(8, 8, 0xFFFF0000);
+    Surface large = Sprite(64, 56, 0xFF00FF00);
+
+    std::vector<std::optional<TextureAtlas::Region>> regions = atlas.Insert({&small, &large});
+    ASSERT_EQ(regions.size(), 2u);
+    ASSERT_TRUE(regions[0]);
+    ASSERT_TRUE(regions[1]);
+    EXPECT_EQ(regions[0]->rect.w, 8);
+    EXPECT_EQ(regions[1]->rect.w, 64);
+    // both share one page
+    EXPECT_EQ(atlas.PageCount(), 1);
+
+    atlas.Clear();
+    EXPECT_EQ(atlas.PageCount(), 0);
+}
@@ -0,0 +1,104 @@
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "libs/SDL2/include/SDL.h"
+
+#include "SDL2wrapper/include/Renderer.h"
+#include "SDL2wrapper/include/Surface.h"
+#include "SDL2wrapper/include/Texture.h"
+
+#include "test/sdl_software_renderer.h"
+
+using namespace sdl2;
+
+// Texture::Update from a surface of another format
+class SDL2wrapperTextureUpdateTest : public ::testing::TestWithParam<int>, protected SDL2wrapperSoftwareRenderer
+{
+protected:
+    SDL2wrapperTextureUpdateTest() :
+        SDL2wrapperSoftwareRenderer(8, 8),
+        // 8x8 ABGR, all zero; the access mode is the parameter
+        texture(CreateTexture(renderer, SDL_PIXELFORMAT_ABGR8888, GetParam(), 8, 8))
+    {
+        std::vector<Uint32> zero(8 * 8, 0);
+        texture.Update(std::nullopt, zero.data(), 8 * 4);
+        texture.BlendMode(SDL_BLENDMODE_NONE);
+    }
+
+    // ARGB at (x, y) of the texture
+    Uint32 Texel(int x, int y)
+    {
+        renderer.Copy(texture);
+        Surface::LockHandle lock = target.Lock();
+        return static_cast<const Uint32*>(lock.Pixels())[y * 8 + x];
+    }
+
+    Texture texture;
+};
+
+TEST_P(SDL2wrapperTextureUpdateTest, ConvertsOnlyThePatch)
+{
+    // large ARGB source: a 4x4 red patch at the origin, blue elsewhere
+    Surface source(0, 256, 256, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    source.FillRect(std::nullopt, 0xFF0000FF);
+    source.FillRect(Rect(0, 0, 4, 4), 0xFFFF0000);
+
+    texture.Update(Rect(2, 3, 4, 4), source);
+
+    EXPECT_EQ(Texel(2, 3), 0xFFFF0000u);
+    EXPECT_EQ(Texel(5, 6), 0xFFFF0000u);
+    EXPECT_EQ(Texel(1, 3) & 0x00FFFFFF, 0u);
+    EXPECT_EQ(Texel(6, 6) & 0x00FFFFFF, 0u);
+    EXPECT_EQ(Texel(2, 7) & 0x00FFFFFF, 0u);
+}
+
+TEST_P(SDL2wrapperTextureUpdateTest, ClipsToTheSurface)
+{
+    Surface source(0, 2, 2, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    source.FillRect(std::nullopt, 0xFF00FF00);
+
+    texture.Update(std::nullopt, std::move(source));
+
+    EXPECT_EQ(Texel(0, 0), 0xFF00FF00u);
+    EXPECT_EQ(Texel(1, 1), 0xFF00FF00u);
+    EXPECT_EQ(Texel(2, 0) & 0x00FFFFFF, 0u);
+    EXPECT_EQ(Texel(0, 2) & 0x00FFFFFF, 0u);
+}
+
+TEST_P(SDL2wrapperTextureUpdateTest, ConvertsIndexedSurfaces)
+{
+    Surface source(0, 64, 64, 8, 0, 0, 0, 0);
+    const SDL_Color colors[] = {{0, 0, 255, 255}, {255, 255, 0, 255}};
+    ASSERT_EQ(SDL_SetPaletteColors(source.Get()->format->palette, colors, 0, 2), 0);
+    source.FillRect(std::nullopt, 0);
+    source.FillRect(Rect(0, 0, 2, 2), 1);
+
+    texture.Update(Rect(4, 4, 3, 3), source);
+
+    EXPECT_EQ(Texel(4, 4), 0xFFFFFF00u);
+    EXPECT_EQ(Texel(5, 5), 0xFFFFFF00u);
+    EXPECT_EQ(Texel(6, 6), 0xFF0000FFu);
+}
+
+TEST_P(SDL2wrapperTextureUpdateTest, KeyedPixelsBecomeTransparent)
+{
+    Surface source(0, 64, 64, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    source.FillRect(std::nullopt, 0xFFFF00FF);
+    source.FillRect(Rect(1, 0, 1, 1), 0xFF00FF00);
+    source.ColorKey(true, 0xFFFF00FF);
+
+    texture.Update(Rect(0, 0, 2, 1), source);
+    texture.BlendMode(SDL_BLENDMODE_BLEND);
+    renderer.SetDrawColor(0, 0, 255);
+    renderer.Clear();
+
+    EXPECT_EQ(Texel(0, 0), 0xFF0000FFu);
+    EXPECT_EQ(Texel(1, 0), 0xFF00FF00u);
+}
+
+INSTANTIATE_TEST_SUITE_P(Access, SDL2wrapperTextureUpdateTest,
+    ::testing::Values(SDL_TEXTUREACCESS_STATIC, SDL_TEXTUREACCESS_STREAMING),
+    [](const ::testing::TestParamInfo<int>& info) {
+        return info.param == SDL_TEXTUREACCESS_STATIC ? "Static" : "Streaming";
+    });